@@ -0,0 +1,57 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#include "ShaderBuilder/Mat2.hpp"
+#include "ShaderBuilder/Mat3.hpp"
+#include "ShaderBuilder/Mat4.hpp"
+#include "ShaderBuilder/SPIRVSource.hpp"
+
+/**
+ * This translation unit measures the time it takes to compile the type traits.
+ * It registers every vector and matrix type, which instantiates all of their traits like a shader with many vector types would.
+ * Build it with the SHADER_BUILDER_BUILD_BENCHMARKS option and time the build of the ShaderBuilderBenchmarks target.
+ */
+
+/**
+ * Register all the vector types of a single value type.
+ *
+ * @tparam Type The value type.
+ * @param source The source to register the types to.
+ */
+template<class Type>
+void RegisterVectors(ShaderBuilder::SPIRVSource& source)
+{
+	source.registerTypes<ShaderBuilder::Vec2<Type>, ShaderBuilder::Vec3<Type>, ShaderBuilder::Vec4<Type>>();
+}
+
+/**
+ * Register all the matrix types of a single value type.
+ *
+ * @tparam Type The value type.
+ * @param source The source to register the types to.
+ */
+template<class Type>
+void RegisterMatrices(ShaderBuilder::SPIRVSource& source)
+{
+	source.registerTypes<ShaderBuilder::Mat2<Type>, ShaderBuilder::Mat3<Type>, ShaderBuilder::Mat4<Type>>();
+}
+
+int main()
+{
+	ShaderBuilder::SPIRVSource source;
+
+	RegisterVectors<int8_t>(source);
+	RegisterVectors<uint8_t>(source);
+	RegisterVectors<int16_t>(source);
+	RegisterVectors<uint16_t>(source);
+	RegisterVectors<int32_t>(source);
+	RegisterVectors<uint32_t>(source);
+	RegisterVectors<int64_t>(source);
+	RegisterVectors<uint64_t>(source);
+	RegisterVectors<float>(source);
+	RegisterVectors<double>(source);
+
+	RegisterMatrices<float>(source);
+	RegisterMatrices<double>(source);
+
+	return 0;
+}
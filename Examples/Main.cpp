@@ -1,9 +1,13 @@
 // Copyright (c) 2022 Dhiraj Wishal
 
 #include "ShaderBuilder/VertexBuilder.hpp"
+#include "ShaderBuilder/ComputeBuilder.hpp"
+#include "ShaderBuilder/MeshBuilder.hpp"
 #include "ShaderBuilder/Vec2.hpp"
 #include "ShaderBuilder/Vec3.hpp"
 #include "ShaderBuilder/Vec4.hpp"
+#include "ShaderBuilder/Mat4.hpp"
+#include "ShaderBuilder/RuntimeArray.hpp"
 #include "ShaderBuilder/Parameter.hpp"
 
 #include "Profiler.hpp"
@@ -47,8 +51,8 @@
 	public:
 		explicit Camera(ShaderBuilder::SPIRVSource& source, const std::string& identifier) : ShaderBuilder::DataType<Camera>(source, identifier), m_Projection(source, source.getUniqueIdentifier()), m_View(source, source.getUniqueIdentifier()) {}
 
-		ShaderBuilder::Vec4<float> m_Projection;	// These should be Mat4.
-		ShaderBuilder::Vec2<float> m_View;			// These should be Mat4.
+		ShaderBuilder::Mat4<float> m_Projection;
+		ShaderBuilder::Mat4<float> m_View;
 	};
 	auto camera = shaderSource.createUniform<Camera>(0, 0, &Camera::m_Projection, &Camera::m_View);
 
@@ -74,6 +78,232 @@
 	return shaderSource.compile(ShaderBuilder::OptimizationFlags::DebugMode);
 }
 
+/**
+ * This generates the same SPIRV as the following GLSL.
+ *
+ * ```GLSL
+ * #extension GL_EXT_mesh_shader : require
+ *
+ * layout (local_size_x = 32) in;
+ *
+ * taskPayloadSharedEXT uint payload[32];
+ *
+ * void main()
+ * {
+ *		payload[gl_LocalInvocationIndex] = gl_LocalInvocationIndex;
+ *		EmitMeshTasksEXT(1, 1, 1);
+ * }
+ * ```
+ */
+[[nodiscard]] ShaderBuilder::SPIRVBinary CreateTaskShader()
+{
+	[[maybe_unused]] Profiler _profiler;
+
+	ShaderBuilder::TaskBuilder shaderSource;
+	shaderSource.setLocalSize(32);
+
+	auto payload = shaderSource.createTaskPayload<ShaderBuilder::Array<ShaderBuilder::Scalar<uint32_t>, 32>>();
+
+	auto function = shaderSource.createFunction([&](ShaderBuilder::TaskFunctionBuilder& builder)
+		{
+			const auto index = builder.getLocalInvocationIndex();
+			payload[index] = index;
+
+			const auto count = builder.createVariable<ShaderBuilder::Scalar<uint32_t>>(1u);
+			builder.emitMeshTasks(count, count, count, payload);
+		}
+	);
+
+	function();
+	shaderSource.addEntryPoint(function);
+
+	return shaderSource.compile(ShaderBuilder::OptimizationFlags::DebugMode);
+}
+
+/**
+ * This generates the same SPIRV as the following GLSL.
+ *
+ * ```GLSL
+ * #extension GL_EXT_mesh_shader : require
+ *
+ * layout (local_size_x = 1) in;
+ * layout (triangles, max_vertices = 3, max_primitives = 1) out;
+ *
+ * layout (location = 0) out vec4 outColors[];
+ * layout (location = 1) perprimitiveEXT out uint outPrimitiveIDs[];
+ *
+ * taskPayloadSharedEXT uint payload[32];
+ *
+ * void main()
+ * {
+ *		SetMeshOutputsEXT(3, 1);
+ *
+ *		gl_MeshVerticesEXT[0].gl_Position = vec4(-0.5, 0.5, 0, 1);
+ *		gl_MeshVerticesEXT[1].gl_Position = vec4(0.5, 0.5, 0, 1);
+ *		gl_MeshVerticesEXT[2].gl_Position = vec4(0, -0.5, 0, 1);
+ *		outColors[0] = vec4(1, 0, 0, 1);
+ *		outColors[1] = vec4(0, 1, 0, 1);
+ *		outColors[2] = vec4(0, 0, 1, 1);
+ *
+ *		gl_PrimitiveTriangleIndicesEXT[0] = uvec3(0, 1, 2);
+ *		outPrimitiveIDs[0] = payload[0];
+ * }
+ * ```
+ */
+[[nodiscard]] ShaderBuilder::SPIRVBinary CreateMeshShader()
+{
+	[[maybe_unused]] Profiler _profiler;
+
+	ShaderBuilder::MeshBuilder<3, 1> shaderSource;
+	shaderSource.setLocalSize(1);
+
+	auto positions = shaderSource.createPositions();
+	auto indices = shaderSource.createPrimitiveIndices();
+	auto outColors = shaderSource.createVertexOutput<ShaderBuilder::Vec4<float>>(0);
+	auto outPrimitiveIDs = shaderSource.createPrimitiveOutput<ShaderBuilder::Scalar<uint32_t>>(1);
+	auto payload = shaderSource.createTaskPayload<ShaderBuilder::Array<ShaderBuilder::Scalar<uint32_t>, 32>>();
+
+	auto function = shaderSource.createFunction([&](ShaderBuilder::MeshFunctionBuilder& builder)
+		{
+			builder.setMeshOutputs(builder.createVariable<ShaderBuilder::Scalar<uint32_t>>(3u), builder.createVariable<ShaderBuilder::Scalar<uint32_t>>(1u));
+
+			positions[0] = builder.createVariable<ShaderBuilder::Vec4<float>>(-0.5f, 0.5f, 0.0f, 1.0f);
+			positions[1] = builder.createVariable<ShaderBuilder::Vec4<float>>(0.5f, 0.5f, 0.0f, 1.0f);
+			positions[2] = builder.createVariable<ShaderBuilder::Vec4<float>>(0.0f, -0.5f, 0.0f, 1.0f);
+			outColors[0] = builder.createVariable<ShaderBuilder::Vec4<float>>(1.0f, 0.0f, 0.0f, 1.0f);
+			outColors[1] = builder.createVariable<ShaderBuilder::Vec4<float>>(0.0f, 1.0f, 0.0f, 1.0f);
+			outColors[2] = builder.createVariable<ShaderBuilder::Vec4<float>>(0.0f, 0.0f, 1.0f, 1.0f);
+
+			indices[0] = builder.createVariable<ShaderBuilder::Vec3<uint32_t>>(0u, 1u, 2u);
+			outPrimitiveIDs[0] = payload[0];
+		}
+	);
+
+	function();
+	shaderSource.addEntryPoint(function);
+
+	return shaderSource.compile(ShaderBuilder::OptimizationFlags::DebugMode);
+}
+
+/**
+ * This generates the same SPIRV as the following GLSL.
+ *
+ * ```GLSL
+ * #extension GL_KHR_shader_subgroup_arithmetic : require
+ *
+ * layout (local_size_x = 64) in;
+ *
+ * layout (set = 0, binding = 0) buffer Values
+ * {
+ * 		uint m_Values[];
+ * } values;
+ *
+ * void main()
+ * {
+ *		uint value = values.m_Values[gl_LocalInvocationIndex];
+ *		values.m_Values[gl_LocalInvocationIndex] = subgroupInclusiveAdd(value);
+ * }
+ * ```
+ */
+[[nodiscard]] ShaderBuilder::SPIRVBinary CreatePrefixSumShader()
+{
+	[[maybe_unused]] Profiler _profiler;
+
+	ShaderBuilder::ComputeBuilder shaderSource;
+	shaderSource.setLocalSize(64);
+
+	class Values final : public ShaderBuilder::DataType<Values>
+	{
+	public:
+		explicit Values(ShaderBuilder::SPIRVSource& source, const std::string& identifier) : ShaderBuilder::DataType<Values>(source, identifier), m_Values(source, source.getUniqueIdentifier()) {}
+
+		ShaderBuilder::RuntimeArray<ShaderBuilder::Scalar<uint32_t>> m_Values;
+	};
+	auto values = shaderSource.createStorageBuffer<Values>(0, 0, ShaderBuilder::MemoryAccess::None, &Values::m_Values);
+
+	auto function = shaderSource.createFunction([&](ShaderBuilder::ComputeFunctionBuilder& builder)
+		{
+			const auto index = builder.getLocalInvocationIndex();
+			const auto value = builder.createVariable<ShaderBuilder::Scalar<uint32_t>>(values.m_Values[index]);
+
+			values.m_Values[index] = builder.subgroupAdd(value, ShaderBuilder::GroupOperation::InclusiveScan);
+		}
+	);
+
+	function();
+	shaderSource.addEntryPoint(function);
+
+	return shaderSource.compile(ShaderBuilder::OptimizationFlags::DebugMode);
+}
+
+/**
+ * This generates the same SPIRV as the following GLSL.
+ *
+ * ```GLSL
+ * #extension GL_EXT_shader_atomic_int64 : require
+ *
+ * layout (local_size_x = 64) in;
+ *
+ * layout (set = 0, binding = 0) buffer Values
+ * {
+ * 		uint64_t m_Total;
+ * 		uint m_Values[];
+ * } values;
+ *
+ * shared uint sums[1];
+ *
+ * void main()
+ * {
+ *		if (gl_LocalInvocationIndex == 0)
+ *			atomicExchange(sums[0], 0);
+ *
+ *		barrier();
+ *		atomicAdd(sums[0], values.m_Values[gl_LocalInvocationIndex], gl_ScopeWorkgroup, gl_StorageSemanticsShared, gl_SemanticsAcquireRelease);
+ *		barrier();
+ *
+ *		if (gl_LocalInvocationIndex == 0)
+ *			atomicAdd(values.m_Total, uint64_t(sums[0]));
+ * }
+ * ```
+ */
+[[nodiscard]] ShaderBuilder::SPIRVBinary CreateSumShader()
+{
+	[[maybe_unused]] Profiler _profiler;
+
+	ShaderBuilder::ComputeBuilder shaderSource;
+	shaderSource.setLocalSize(64);
+
+	class Values final : public ShaderBuilder::DataType<Values>
+	{
+	public:
+		explicit Values(ShaderBuilder::SPIRVSource& source, const std::string& identifier) : ShaderBuilder::DataType<Values>(source, identifier), m_Total(source, source.getUniqueIdentifier()), m_Values(source, source.getUniqueIdentifier()) {}
+
+		ShaderBuilder::Scalar<uint64_t> m_Total;
+		ShaderBuilder::RuntimeArray<ShaderBuilder::Scalar<uint32_t>> m_Values;
+	};
+	auto values = shaderSource.createStorageBuffer<Values>(0, 0, ShaderBuilder::MemoryAccess::None, &Values::m_Total, &Values::m_Values);
+	auto sums = shaderSource.createSharedArray<ShaderBuilder::Scalar<uint32_t>, 1>();
+
+	auto function = shaderSource.createFunction([&](ShaderBuilder::ComputeFunctionBuilder& builder)
+		{
+			const auto index = builder.getLocalInvocationIndex();
+
+			builder.ifThen(index == 0u, [&] { builder.atomicExchange(sums[0], 0u); });
+			builder.workgroupBarrier();
+
+			builder.atomicAdd(sums[0], values.m_Values[index], ShaderBuilder::Scope::Workgroup, ShaderBuilder::MemorySemantics::AcquireRelease);
+			builder.workgroupBarrier();
+
+			builder.ifThen(index == 0u, [&] { builder.atomicAdd(values.m_Total, ShaderBuilder::Convert<uint64_t>(sums[0])); });
+		}
+	);
+
+	function();
+	shaderSource.addEntryPoint(function);
+
+	return shaderSource.compile(ShaderBuilder::OptimizationFlags::DebugMode);
+}
+
 int main()
 {
 	// Generate the shader.
@@ -90,5 +320,19 @@ int main()
 	std::cout << output.getHLSL() << std::endl;
 
 	std::cout << "-------------------- MSL --------------------" << std::endl;
-	std::cout << output.getMSL();
+	std::cout << output.getMSL() << std::endl;
+
+	// Generate the task and mesh shaders. Compiling validates them, so they can be checked without a GPU.
+	// Generate the compute shaders.
+	std::cout << "-------------------- Prefix Sum Shader --------------------" << std::endl;
+	std::cout << CreatePrefixSumShader().disassemble() << std::endl;
+
+	std::cout << "-------------------- Sum Shader --------------------" << std::endl;
+	std::cout << CreateSumShader().disassemble() << std::endl;
+
+	std::cout << "-------------------- Task Shader --------------------" << std::endl;
+	std::cout << CreateTaskShader().disassemble() << std::endl;
+
+	std::cout << "-------------------- Mesh Shader --------------------" << std::endl;
+	std::cout << CreateMeshShader().disassemble() << std::endl;
 }
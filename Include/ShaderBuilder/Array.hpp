@@ -0,0 +1,114 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Scalar.hpp"
+#include "BuilderError.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Array class.
+	 * This is an array which size is known when building the shader, like a shared memory array of a compute shader.
+	 *
+	 * @tparam Type The element type.
+	 * @tparam Length The number of elements.
+	 */
+	template<class Type, uint32_t Length>
+	class Array final : public DataType<Array<Type, Length>>
+	{
+	public:
+		using Super = DataType<Array<Type, Length>>;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 */
+		explicit Array(SPIRVSource& source, const std::string& variableName) : Super(source, variableName) {}
+
+		/**
+		 * Access an element of the array.
+		 * This records an access chain in the current function, so the returned element can only be used within it.
+		 *
+		 * @param index The index of the element.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type operator[](uint32_t index)
+		{
+			if (index >= Length)
+				throw BuilderError("The array index is out of bounds!");
+
+			return getElement(Super::storeConstant(index));
+		}
+
+		/**
+		 * Access an element of the array using an index computed in the shader.
+		 * This records an access chain in the current function, so the returned element can only be used within it.
+		 *
+		 * @param index The index of the element.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type operator[](const Scalar<uint32_t>& index) { return getElement(index.getValueIdentifier()); }
+
+	private:
+		/**
+		 * Get an element of the array using the index identifier.
+		 *
+		 * @param indexIdentifier The identifier of the index.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type getElement(const std::string& indexIdentifier)
+		{
+			const auto arrayPointer = Super::getPointerIdentifier();
+			const auto pointerType = Super::m_Source.template registerPointerType<Type>(Super::m_StorageClass);
+
+			const auto identifier = Super::m_Source.getUniqueIdentifier();
+			Super::m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpAccessChain {} {} {}", identifier, pointerType, arrayPointer, indexIdentifier));
+
+			Super::decorateNonUniform(identifier);
+
+			auto element = Type(Super::m_Source, identifier);
+			element.setStorageClass(Super::m_StorageClass);
+
+			// Elements of non-uniform arrays are non-uniform too.
+			if (Super::isNonUniform())
+				element.markNonUniform();
+
+			return element;
+		}
+	};
+
+	/**
+	 * Array type traits.
+	 * The length is declared using a 32 bit unsigned integer constant, which is stored when registering the type.
+	 *
+	 * @tparam ElementType The element type.
+	 * @tparam ElementCount The number of elements.
+	 */
+	template<class ElementType, uint32_t ElementCount>
+	struct TypeTraits<Array<ElementType, ElementCount>>
+	{
+		using Type = Array<ElementType, ElementCount>;
+		using ValueTraits = TypeTraits<ElementType>;
+		static constexpr auto& RawIdentifier = StaticString<ConcatenateStrings("array_", ValueTraits::RawIdentifier, "_", ToStringLiteral<ElementCount>())>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeArray ", ValueTraits::Identifier, " %const_uint32_", ToStringLiteral<ElementCount>())>;
+		static constexpr uint32_t Length = ElementCount;
+		static constexpr uint8_t Size = 0;
+	};
+
+	/**
+	 * Is complex type boolean specialization
+	 */
+	template<class Type, uint32_t Length>
+	constexpr bool IsCompexType<Array<Type, Length>> = true;
+
+	/**
+	 * Is array type boolean specialization
+	 */
+	template<class Type, uint32_t Length>
+	constexpr bool IsArrayType<Array<Type, Length>> = true;
+} // namespace ShaderBuilder
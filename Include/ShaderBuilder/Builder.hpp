@@ -4,11 +4,16 @@
 
 #include "SPIRVBinary.hpp"
 #include "Function.hpp"
+#include "ImportedFunction.hpp"
 
 #include "Input.hpp"
 #include "Output.hpp"
+#include "Layout.hpp"
+#include "DescriptorArray.hpp"
+#include "BuilderError.hpp"
 
 #include <array>
+#include <unordered_map>
 
 namespace ShaderBuilder
 {
@@ -23,6 +28,8 @@ namespace ShaderBuilder
 		Geometry,
 		Fragment,
 		Compute,
+		Task,
+		Mesh,
 	};
 
 	/**
@@ -47,6 +54,17 @@ namespace ShaderBuilder
 		Vulkan
 	};
 
+	/**
+	 * Push constant policy enum.
+	 * This defines what to do with uniforms which are small enough to fit in the push constant budget.
+	 */
+	enum class PushConstantPolicy : uint8_t
+	{
+		None,
+		Suggest,
+		Promote
+	};
+
 	/**
 	 * Configuration structure.
 	 * This contains basic information about the shader code that is being built.
@@ -56,6 +74,20 @@ namespace ShaderBuilder
 		AddressingModel m_AddressingModel = AddressingModel::Logical;
 		MemoryModel m_MemoryModel = MemoryModel::GLSL450;
 
+		// Reorder the block members to reduce the padding. Use getBlockLayout() to get the final offsets.
+		bool m_OptimizeBlockLayouts = false;
+
+		// The maximum size of the push constant block in bytes. 128 bytes is the minimum guaranteed by Vulkan.
+		uint32_t m_PushConstantBudget = 128;
+
+		// Whether to suggest or move uniforms which fit in the budget to push constants, if there isn't a push constant block already.
+		PushConstantPolicy m_PushConstantPolicy = PushConstantPolicy::None;
+
+		// The maximum number of instructions a function can have to be inlined into its callers. 0 disables inlining.
+		uint32_t m_InlineThreshold = 0;
+
+		// The precision policy every function starts with. Functions and data types can override it.
+		PrecisionPolicy m_PrecisionPolicy;
 	};
 
 	/**
@@ -78,6 +110,25 @@ namespace ShaderBuilder
 	[[nodiscard]] constexpr OptimizationFlags operator|(OptimizationFlags lhs, OptimizationFlags rhs) { return static_cast<OptimizationFlags>(static_cast<std::underlying_type_t<OptimizationFlags>>(lhs) | static_cast<std::underlying_type_t<OptimizationFlags>>(rhs)); }
 	[[nodiscard]] constexpr bool operator&(OptimizationFlags lhs, OptimizationFlags rhs) { return static_cast<std::underlying_type_t<OptimizationFlags>>(lhs) & static_cast<std::underlying_type_t<OptimizationFlags>>(rhs); }
 
+	/**
+	 * Memory access flags enum.
+	 * These tell the driver how a storage buffer is accessed, which lets it pick a faster memory path.
+	 */
+	enum class MemoryAccess : uint8_t
+	{
+		None = 0,
+		NonWritable = 1 << 0,
+		NonReadable = 1 << 1,
+		Restrict = 1 << 2,
+		Coherent = 1 << 3,
+
+		ReadOnly = NonWritable | Restrict,
+		WriteOnly = NonReadable | Restrict
+	};
+
+	[[nodiscard]] constexpr MemoryAccess operator|(MemoryAccess lhs, MemoryAccess rhs) { return static_cast<MemoryAccess>(static_cast<std::underlying_type_t<MemoryAccess>>(lhs) | static_cast<std::underlying_type_t<MemoryAccess>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(MemoryAccess lhs, MemoryAccess rhs) { return static_cast<std::underlying_type_t<MemoryAccess>>(lhs) & static_cast<std::underlying_type_t<MemoryAccess>>(rhs); }
+
 	/**
 	 * Builder class.
 	 * This class contains the base code for SPIR-V generation and can be used to
@@ -126,6 +177,8 @@ namespace ShaderBuilder
 		 * Create a new Uniform.
 		 *
 		 * Note that members should be pointers to the member variables and should be in the same order they appear in the actual struct.
+		 * The member offsets are computed using the std140 layout rules. Depending on the push constant policy, the uniform might be
+		 * moved to push constants, in which case isPushConstant() returns true and the offsets are computed using std430.
 		 * For example,
 		 *
 		 * ```c++
@@ -145,37 +198,236 @@ namespace ShaderBuilder
 		{
 			const auto identifier = m_Source.getUniqueIdentifier();
 
-			// Register the members.
-			m_Source.insertType(fmt::format("%type_{} = OpTypeStruct {}", identifier, m_Source.resolveMemberVariableTypeIdentifiers<Members...>()));
+			// Create the uniform and setup the block.
+			auto uniform = Type(m_Source, identifier);
+			auto layout = createBlockLayout(uniform, LayoutRule::Std140, members...);
 
-			// Setup type declarations.
-			m_Source.insertType(fmt::format("%uniform_{} = OpTypePointer Uniform %type_{}", identifier, identifier));
-			m_Source.insertType(fmt::format("%{} = OpVariable %uniform_{} Uniform", identifier, identifier));
+			// Move the uniform to push constants if the policy allows it.
+			if (shouldPromoteToPushConstant(identifier, layout))
+			{
+				insertPushConstant(identifier, createBlockLayout(uniform, LayoutRule::Std430, members...));
+				bindBlockMembers(uniform, "PushConstant", members...);
+				return uniform;
+			}
 
-			// Set the type debug information and annotations.
-			m_Source.insertName(fmt::format("OpName %uniform_{} \"{}\"", identifier, identifier));
-			m_Source.insertName(fmt::format("OpName %{} \"\"", identifier));
+			insertBlock(identifier, "Uniform", std::move(layout));
+			bindBlockMembers(uniform, "Uniform", members...);
+			insertDescriptorBinding(identifier, set, binding);
 
-			m_Source.insertAnnotation(fmt::format("OpDecorate %{} DescriptorSet {}", identifier, set));
-			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Binding {}", identifier, binding));
+			return uniform;
+		}
 
-			// Create the uniform.
+		/**
+		 * Create a new storage buffer.
+		 *
+		 * Note that members should be pointers to the member variables and should be in the same order they appear in the actual struct.
+		 * The member offsets are computed using the std430 layout rules. A RuntimeArray can be used as the last member.
+		 * For example,
+		 *
+		 * ```c++
+		 * struct Instances { RuntimeArray<Mat4<float>> Transforms = ...; };
+		 * auto instances = builder.createStorageBuffer<Instances>(0, 1, MemoryAccess::ReadOnly, &Instances::Transforms);
+		 * auto transform = instances.Transforms[2];
+		 * ```
+		 *
+		 * @tparam Type The type of the storage buffer.
+		 * @tparam Members The storage buffer's members.
+		 * @param set The descriptor set index.
+		 * @param binding The storage buffer's binding.
+		 * @param access How the shader accesses the storage buffer.
+		 * @param members The members of the storage buffer.
+		 * @return The created storage buffer.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] Type createStorageBuffer(uint32_t set, uint32_t binding, MemoryAccess access, Members... members)
+		{
+			const auto identifier = m_Source.getUniqueIdentifier();
+
+			// Create the storage buffer and setup the block.
+			auto storageBuffer = Type(m_Source, identifier);
+			insertBlock(identifier, "StorageBuffer", createBlockLayout(storageBuffer, LayoutRule::Std430, members...));
+			bindBlockMembers(storageBuffer, "StorageBuffer", members...);
+
+			insertDescriptorBinding(identifier, set, binding);
+			insertMemoryAccess(identifier, access);
+
+			return storageBuffer;
+		}
+
+		/**
+		 * Create a new array of uniforms which share a single binding (a descriptor array).
+		 * The blocks are selected in the shader, so the host does not need to rebind the descriptors for each draw.
+		 *
+		 * Note that members should be pointers to the member variables and should be in the same order they appear in the actual struct.
+		 * The member offsets are computed using the std140 layout rules. Uniform arrays are never moved to push constants.
+		 * For example,
+		 *
+		 * ```c++
+		 * struct Material { Vec4 Color = Vec4("Color"); };
+		 * auto materials = builder.createUniformArray<Material>(1, 0, 0, &Material::Color);
+		 * auto color = materials[NonUniform(materialIndex)].Color;
+		 * ```
+		 *
+		 * @tparam Type The type of the uniform.
+		 * @tparam Members The uniform's members.
+		 * @param set The descriptor set index.
+		 * @param binding The array's binding.
+		 * @param count The number of uniforms in the array. If this is 0, the array is runtime sized (which requires descriptor indexing).
+		 * @param members The members of the uniform.
+		 * @return The created array.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] DescriptorArray<Type, Members...> createUniformArray(uint32_t set, uint32_t binding, uint32_t count, Members... members)
+		{
+			const auto identifier = m_Source.getUniqueIdentifier();
+
+			// Create a uniform to setup the block, which is shared by all the elements.
 			auto uniform = Type(m_Source, identifier);
+			insertBlock(identifier, "Uniform", createBlockLayout(uniform, LayoutRule::Std140, members...), count);
+			insertDescriptorBinding(identifier, set, binding);
 
-			uint64_t counter = 0, offsets = 0;
-			auto logMemberInformation = [this, &uniform, &identifier, &counter, &offsets](auto member)
-			{
-				m_Source.insertName(fmt::format("OpMemberName %type_{} {} \"{}\"", identifier, counter, (uniform.*member).getName()));
-				m_Source.insertAnnotation(fmt::format("OpMemberDecorate %type_{} {} Offset {}", identifier, counter, offsets));
+			return DescriptorArray<Type, Members...>(m_Source, identifier, "Uniform", getMemberIndices(uniform, members...), members...);
+		}
 
-				counter++;
-				offsets += TypeTraits<typename MemberVariableType<decltype(member)>::Type>::Size;
-			};
-			(logMemberInformation(members), ...);
+		/**
+		 * Create a new array of storage buffers which share a single binding (a descriptor array).
+		 * The buffers are selected in the shader, so the host does not need to rebind the descriptors for each draw.
+		 *
+		 * Note that members should be pointers to the member variables and should be in the same order they appear in the actual struct.
+		 * The member offsets are computed using the std430 layout rules. A RuntimeArray can be used as the last member.
+		 *
+		 * @tparam Type The type of the storage buffer.
+		 * @tparam Members The storage buffer's members.
+		 * @param set The descriptor set index.
+		 * @param binding The array's binding.
+		 * @param count The number of storage buffers in the array. If this is 0, the array is runtime sized (which requires descriptor indexing).
+		 * @param access How the shader accesses the storage buffers.
+		 * @param members The members of the storage buffer.
+		 * @return The created array.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] DescriptorArray<Type, Members...> createStorageBufferArray(uint32_t set, uint32_t binding, uint32_t count, MemoryAccess access, Members... members)
+		{
+			const auto identifier = m_Source.getUniqueIdentifier();
 
-			return uniform;
+			// Create a storage buffer to setup the block, which is shared by all the elements.
+			auto storageBuffer = Type(m_Source, identifier);
+			insertBlock(identifier, "StorageBuffer", createBlockLayout(storageBuffer, LayoutRule::Std430, members...), count);
+			insertDescriptorBinding(identifier, set, binding);
+			insertMemoryAccess(identifier, access);
+
+			return DescriptorArray<Type, Members...>(m_Source, identifier, "StorageBuffer", getMemberIndices(storageBuffer, members...), members...);
+		}
+
+		/**
+		 * Create a new push constant block.
+		 * There can only be one push constant block in a shader and its size is checked against the push constant budget.
+		 *
+		 * Note that members should be pointers to the member variables and should be in the same order they appear in the actual struct.
+		 * The member offsets are computed using the std430 layout rules.
+		 * For example,
+		 *
+		 * ```c++
+		 * struct Draw { Mat4 Model = Mat4("Model"); Vec4 Color = Vec4("Color"); };
+		 * auto draw = builder.createPushConstant<Draw>(&Draw::Model, &Draw::Color);
+		 * ```
+		 *
+		 * @tparam Type The type of the push constant block.
+		 * @tparam Members The block's members.
+		 * @param members The members of the block.
+		 * @return The created push constant block.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] Type createPushConstant(Members... members)
+		{
+			const auto identifier = m_Source.getUniqueIdentifier();
+
+			// Create the push constant and setup the block.
+			auto pushConstant = Type(m_Source, identifier);
+			insertPushConstant(identifier, createBlockLayout(pushConstant, LayoutRule::Std430, members...));
+			bindBlockMembers(pushConstant, "PushConstant", members...);
+
+			return pushConstant;
+		}
+
+		/**
+		 * Check if a block is the push constant block.
+		 * This is useful to know if a uniform was moved to push constants.
+		 *
+		 * @tparam Type The block type.
+		 * @param block The block created by the builder.
+		 * @return True if the block is the push constant block.
+		 * @return False if the block is not the push constant block.
+		 */
+		template<class Type>
+		[[nodiscard]] bool isPushConstant(const DataType<Type>& block) const { return block.getName() == m_PushConstantBlock; }
+
+		/**
+		 * Get the layout of a block.
+		 * This contains the final member offsets which should be used by the host to fill the block.
+		 *
+		 * @tparam Type The block type.
+		 * @param block The block created by the builder (like createUniform()).
+		 * @return The block layout.
+		 */
+		template<class Type>
+		[[nodiscard]] const BlockLayout& getBlockLayout(const DataType<Type>& block) const
+		{
+			const auto itr = m_BlockLayouts.find(block.getName());
+			if (itr == m_BlockLayouts.end())
+				throw BuilderError("The provided data type is not a block created by the builder!");
+
+			return itr->second;
 		}
 
+		/**
+		 * Get the layout of the blocks of a descriptor array.
+		 *
+		 * @tparam Type The block type.
+		 * @tparam Members The block's members.
+		 * @param array The array created by the builder (like createUniformArray()).
+		 * @return The block layout.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] const BlockLayout& getBlockLayout(const DescriptorArray<Type, Members...>& array) const { return m_BlockLayouts.at(array.getName()); }
+
+		/**
+		 * Import a function from a library.
+		 * The function is declared here and the definition is resolved when compiling, using the libraries provided through linkLibrary().
+		 *
+		 * @tparam Return The return type of the function.
+		 * @tparam Parameters The parameter types of the function.
+		 * @param linkageName The name the function was exported with.
+		 * @return The imported function.
+		 */
+		template<class Return, class... Parameters>
+		[[nodiscard]] ImportedFunction<Return, Parameters...> importFunction(const std::string& linkageName)
+		{
+			return ImportedFunction<Return, Parameters...>(m_Source, linkageName);
+		}
+
+		/**
+		 * Link a pre-compiled library to the shader.
+		 * All the libraries are linked to the shader when compiling.
+		 *
+		 * @param library The library binary.
+		 */
+		void linkLibrary(const SPIRVBinary& library);
+
+		/**
+		 * Link the shader to the next stage of the pipeline.
+		 * The inputs of the next stage are matched with the outputs of this shader using their locations and types. The outputs which the next stage
+		 * does not read are removed, along with the instructions which only compute them. The inputs the next stage never uses are removed first, so
+		 * they do not keep any outputs alive.
+		 * This modifies both the builders, so compiling them afterwards produces the linked shaders. Link copies of the builders to keep the originals
+		 * (CompilePipeline() does this).
+		 * Make sure that the entry points of both the shaders are added before linking.
+		 *
+		 * @param nextStage The builder of the next stage.
+		 * @throws BuilderError If an input of the next stage is not written by this shader, or if the types of an input and its output do not match.
+		 */
+		void linkNextStage(Builder& nextStage);
+
 	public:
 		/**
 		 * Get the internal string.
@@ -199,7 +451,138 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] SPIRVBinary compile(OptimizationFlags flags = OptimizationFlags::Release) const;
 
+	protected:
+		/**
+		 * Create the layout of a block.
+		 * This will register all the member types.
+		 *
+		 * @tparam Type The block type.
+		 * @tparam Members The block's members.
+		 * @param block The block to get the member names from.
+		 * @param rule The rule to compute the member offsets with.
+		 * @param members The members of the block.
+		 * @return The block layout.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] BlockLayout createBlockLayout(Type& block, LayoutRule rule, Members... members)
+		{
+			std::vector<MemberLayout> layouts;
+			layouts.reserve(sizeof...(Members));
+
+			auto resolveMember = [this, &block, &layouts, rule](auto member)
+			{
+				using MemberType = typename MemberVariableType<decltype(member)>::Type;
+				using Layout = TypeLayout<MemberType>;
+
+				m_Source.registerType<MemberType>();
+
+				auto& layout = layouts.emplace_back();
+				layout.m_Name = (block.*member).getName();
+				layout.m_TypeIdentifier = TypeTraits<MemberType>::Identifier;
+				layout.m_Size = Layout::size(rule);
+				layout.m_Alignment = Layout::alignment(rule);
+				layout.m_MatrixStride = Layout::matrixStride(rule);
+				layout.m_ArrayStride = Layout::arrayStride(rule);
+				layout.m_IsRuntimeArray = IsRuntimeArrayType<MemberType>;
+			};
+			(resolveMember(members), ...);
+
+			return BlockLayout(std::move(layouts), rule, m_Configuration.m_OptimizeBlockLayouts);
+		}
+
+		/**
+		 * Bind the members of a block to the block variable.
+		 * This must be done after inserting the block, so the member indexes are final.
+		 *
+		 * @tparam Type The block type.
+		 * @tparam Members The block's members.
+		 * @param block The block.
+		 * @param storageClass The storage class of the block variable.
+		 * @param members The members of the block.
+		 */
+		template<class Type, class... Members>
+		void bindBlockMembers(Type& block, const char* storageClass, Members... members)
+		{
+			const auto& layout = m_BlockLayouts.at(block.getName());
+			auto bindMember = [&block, &layout, storageClass](auto member)
+			{
+				auto& variable = block.*member;
+				variable.bindToBlock(block.getName(), layout.getMember(variable.getName()).m_Index, storageClass);
+			};
+			(bindMember(members), ...);
+		}
+
+		/**
+		 * Get the indices of the members of a block.
+		 * This must be done after inserting the block, so the member indexes are final.
+		 *
+		 * @tparam Type The block type.
+		 * @tparam Members The block's members.
+		 * @param block The block.
+		 * @param members The members of the block.
+		 * @return The member indices, in the same order as the members.
+		 */
+		template<class Type, class... Members>
+		[[nodiscard]] std::array<uint32_t, sizeof...(Members)> getMemberIndices(Type& block, Members... members) const
+		{
+			const auto& layout = m_BlockLayouts.at(block.getName());
+			return { layout.getMember((block.*members).getName()).m_Index... };
+		}
+
+		/**
+		 * Insert a block's type, variable and layout decorations.
+		 *
+		 * @param identifier The block's identifier.
+		 * @param storageClass The storage class of the block variable.
+		 * @param layout The block layout.
+		 * @param descriptorCount The number of blocks if the variable is a descriptor array. 0 means that the array is runtime sized. Default is none.
+		 */
+		void insertBlock(const std::string& identifier, const char* storageClass, BlockLayout&& layout, std::optional<uint32_t> descriptorCount = std::nullopt);
+
+		/**
+		 * Insert the descriptor set and binding decorations of a resource.
+		 *
+		 * @param identifier The resource's identifier.
+		 * @param set The descriptor set index.
+		 * @param binding The binding.
+		 */
+		void insertDescriptorBinding(const std::string& identifier, uint32_t set, uint32_t binding);
+
+		/**
+		 * Insert the memory access decorations of a storage buffer.
+		 *
+		 * @param identifier The storage buffer's identifier.
+		 * @param access How the shader accesses the storage buffer.
+		 */
+		void insertMemoryAccess(const std::string& identifier, MemoryAccess access);
+
+		/**
+		 * Insert the push constant block.
+		 * This warns if the block exceeds the push constant budget.
+		 *
+		 * @param identifier The block's identifier.
+		 * @param layout The block layout.
+		 */
+		void insertPushConstant(const std::string& identifier, BlockLayout&& layout);
+
+		/**
+		 * Check if a uniform should be moved to push constants.
+		 * This will print a suggestion instead if the policy is set to suggest.
+		 *
+		 * @param identifier The uniform's identifier.
+		 * @param layout The uniform's layout.
+		 * @return True if the uniform should be moved.
+		 * @return False if the uniform should stay as it is.
+		 */
+		[[nodiscard]] bool shouldPromoteToPushConstant(const std::string& identifier, const BlockLayout& layout) const;
+
 	protected:
 		SPIRVSource m_Source;
+		Configuration m_Configuration;
+
+		std::unordered_map<std::string, BlockLayout> m_BlockLayouts;
+		std::unordered_map<std::string, uint32_t> m_ArrayStrides;
+		std::string m_PushConstantBlock;
+		std::vector<SPIRVBinary> m_Libraries;
 	};
 } // namespace ShaderBuilder
\ No newline at end of file
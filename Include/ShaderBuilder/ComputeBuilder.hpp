@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Builder.hpp"
+#include "BuilderError.hpp"
+#include "Vec3.hpp"
+#include "Array.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Compute function builder class.
+	 * This contains the compute shader specific code that can be accessed by a compute shader.
+	 * The built-in variables are declared on their first use, so only the used ones end up in the entry point's interface.
+	 * Task and mesh shaders run in workgroups too, so their function builders extend this.
+	 */
+	class ComputeFunctionBuilder : public FunctionBuilder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The SPIRV source.
+		 */
+		explicit ComputeFunctionBuilder(SPIRVSource& source) : FunctionBuilder(source) {}
+
+		/**
+		 * Get the global invocation ID.
+		 * This is the index of the invocation within the whole dispatch.
+		 *
+		 * @return The global invocation ID.
+		 */
+		[[nodiscard]] Vec3<uint32_t> getGlobalInvocationId() { return getBuiltIn<Vec3<uint32_t>>("GlobalInvocationId"); }
+
+		/**
+		 * Get the local invocation ID.
+		 * This is the index of the invocation within its workgroup.
+		 *
+		 * @return The local invocation ID.
+		 */
+		[[nodiscard]] Vec3<uint32_t> getLocalInvocationId() { return getBuiltIn<Vec3<uint32_t>>("LocalInvocationId"); }
+
+		/**
+		 * Get the local invocation index.
+		 * This is the local invocation ID flattened to a single index.
+		 *
+		 * @return The local invocation index.
+		 */
+		[[nodiscard]] Scalar<uint32_t> getLocalInvocationIndex() { return getBuiltIn<Scalar<uint32_t>>("LocalInvocationIndex"); }
+
+		/**
+		 * Get the workgroup ID.
+		 * This is the index of the workgroup within the dispatch.
+		 *
+		 * @return The workgroup ID.
+		 */
+		[[nodiscard]] Vec3<uint32_t> getWorkgroupId() { return getBuiltIn<Vec3<uint32_t>>("WorkgroupId"); }
+
+		/**
+		 * Get the number of workgroups.
+		 * This is the size of the dispatch.
+		 *
+		 * @return The number of workgroups.
+		 */
+		[[nodiscard]] Vec3<uint32_t> getNumWorkgroups() { return getBuiltIn<Vec3<uint32_t>>("NumWorkgroups"); }
+
+		/**
+		 * Get the ID of the invocation within its subgroup.
+		 *
+		 * @return The subgroup invocation ID.
+		 */
+		[[nodiscard]] Scalar<uint32_t> getSubgroupInvocationId()
+		{
+			m_Source.insertCapability("OpCapability GroupNonUniform");
+			return getBuiltIn<Scalar<uint32_t>>("SubgroupLocalInvocationId");
+		}
+
+		/**
+		 * Get the number of invocations in a subgroup.
+		 *
+		 * @return The subgroup size.
+		 */
+		[[nodiscard]] Scalar<uint32_t> getSubgroupSize()
+		{
+			m_Source.insertCapability("OpCapability GroupNonUniform");
+			return getBuiltIn<Scalar<uint32_t>>("SubgroupSize");
+		}
+
+		/**
+		 * Wait for all the invocations in the workgroup and make their shared memory writes visible.
+		 * This is the same as GLSL's barrier().
+		 */
+		void workgroupBarrier() { controlBarrier(Scope::Workgroup, Scope::Workgroup, MemorySemantics::AcquireRelease | MemorySemantics::WorkgroupMemory); }
+	};
+
+	/**
+	 * Compute builder class.
+	 * This contains the workgroup size and the shared memory of a compute shader.
+	 * Task and mesh shaders run in workgroups too, so their builders extend this.
+	 */
+	class ComputeBuilder : public Builder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
+		 */
+		explicit ComputeBuilder(Configuration config = Configuration()) : Builder(config) {}
+
+		/**
+		 * Create a new function.
+		 *
+		 * Note that the instructions will be recorded only in the first run.
+		 *
+		 * @tparam Lambda The lambda type.
+		 * @param function The function definition. Make sure that the function's first parameter/ argument is FunctionBuilder&.
+		 * @param control The function control flags. Default is None.
+		 * @return The function.
+		 */
+		template<class Lambda>
+		[[nodiscard]] decltype(auto) createFunction(Lambda&& function, FunctionControl control = FunctionControl::None) { return Function<std::decay_t<Lambda>>(m_Source, std::forward<Lambda>(function), control); }
+
+		/**
+		 * Set the local (workgroup) size.
+		 *
+		 * @param x The size in the x dimension.
+		 * @param y The size in the y dimension. Default is 1.
+		 * @param z The size in the z dimension. Default is 1.
+		 */
+		void setLocalSize(uint32_t x, uint32_t y = 1, uint32_t z = 1);
+
+		/**
+		 * Make the local size specializable.
+		 * The sizes set using setLocalSize() become the default values of the specialization constants with the given IDs.
+		 * This uses the WorkgroupSize built-in, which works without LocalSizeId (and so without maintenance4).
+		 *
+		 * @param x The specialization constant ID of the x dimension.
+		 * @param y The specialization constant ID of the y dimension.
+		 * @param z The specialization constant ID of the z dimension.
+		 */
+		void setLocalSizeSpecializationIds(uint32_t x, uint32_t y, uint32_t z);
+
+		/**
+		 * Create a new shared array.
+		 * Shared arrays live in the workgroup memory and are visible to all the invocations in a workgroup.
+		 *
+		 * @tparam Type The element type.
+		 * @tparam Length The number of elements.
+		 * @return The created array.
+		 */
+		template<class Type, uint32_t Length>
+		[[nodiscard]] Array<Type, Length> createSharedArray() { return createGlobalVariable<Array<Type, Length>>("Workgroup"); }
+
+		/**
+		 * Add an entry point to the shader.
+		 * Note that this will record the entry point function if it hasn't been recorded already.
+		 *
+		 * @tparam FunctionType The function type.
+		 * @param function The entry point function. Make sure that the return type is void and there are no parameters.
+		 */
+		template<class FunctionType>
+		void addEntryPoint(FunctionType& function)
+		{
+			// Validate the entry point and record it.
+			if constexpr (FunctionType::ParameterCount > 0 || !std::is_void_v<typename FunctionType::ReturnType>)
+				throw BuilderError("Entry points should not have any parameters and the return type should be void!");
+
+			else
+				function.record();
+
+			const auto& name = function.getName();
+			m_Source.insertEntryPoint(fmt::format("OpEntryPoint {} %{} \"{}\"{}", m_ExecutionModel, name, name, m_Source.getInterfaceVariables()));
+			insertExecutionModes(name);
+		}
+
+	protected:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
+		 * @param executionModel The execution model of the entry points.
+		 */
+		explicit ComputeBuilder(Configuration config, const char* executionModel) : Builder(config), m_ExecutionModel(executionModel) {}
+
+		/**
+		 * Create a new global variable.
+		 * The variable is added to the entry point's interface.
+		 *
+		 * @tparam Type The variable type.
+		 * @param storageClass The storage class of the variable.
+		 * @return The created variable.
+		 */
+		template<class Type>
+		[[nodiscard]] Type createGlobalVariable(const char* storageClass)
+		{
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.insertType(fmt::format("%{} = OpVariable {} {}", identifier, m_Source.registerPointerType<Type>(storageClass), storageClass));
+			m_Source.insertInterfaceVariable(identifier);
+
+			auto variable = Type(m_Source, identifier);
+			variable.setStorageClass(storageClass);
+
+			return variable;
+		}
+
+		/**
+		 * Insert the execution modes of an entry point.
+		 *
+		 * @param name The name of the entry point function.
+		 */
+		virtual void insertExecutionModes(const std::string& name);
+
+	private:
+		const char* m_ExecutionModel = "GLCompute";
+
+		std::array<uint32_t, 3> m_LocalSize = { 1, 1, 1 };
+		std::array<uint32_t, 3> m_LocalSizeSpecializationIds = {};
+
+		bool m_IsLocalSizeSpecializable = false;
+	};
+} // namespace ShaderBuilder
@@ -59,6 +59,145 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] std::string getIdentifier() const { return "%" + m_VariableName; }
 
+		/**
+		 * Bind the data type to a member of a block (uniform, storage buffer and so on).
+		 * Block members do not have their own variables, so they are accessed through the block variable.
+		 *
+		 * @param blockIdentifier The identifier of the block variable.
+		 * @param memberIndex The index of the member in the block.
+		 * @param storageClass The storage class of the block.
+		 */
+		void bindToBlock(const std::string& blockIdentifier, uint32_t memberIndex, const char* storageClass)
+		{
+			m_BlockIdentifier = blockIdentifier;
+			m_MemberIndex = memberIndex;
+			m_StorageClass = storageClass;
+		}
+
+		/**
+		 * Bind the data type to a member of an element of a block array (descriptor array).
+		 *
+		 * @param blockIdentifier The identifier of the block array variable.
+		 * @param elementIndex The identifier of the index of the block in the array.
+		 * @param memberIndex The index of the member in the block.
+		 * @param storageClass The storage class of the block.
+		 */
+		void bindToBlockElement(const std::string& blockIdentifier, const std::string& elementIndex, uint32_t memberIndex, const char* storageClass)
+		{
+			bindToBlock(blockIdentifier, memberIndex, storageClass);
+			m_BlockElementIndex = elementIndex;
+		}
+
+		/**
+		 * Mark the data type as non-uniform.
+		 * This is required when the data is accessed through a resource which is not the same for all the invocations (like a descriptor array indexed using
+		 * NonUniform()). The pointers and loaded values are decorated with NonUniform.
+		 */
+		void markNonUniform() { m_IsNonUniform = true; }
+
+		/**
+		 * Check if the data type is non-uniform.
+		 *
+		 * @return True if the data type is accessed through a non-uniform resource.
+		 * @return False if the data type is uniform.
+		 */
+		[[nodiscard]] bool isNonUniform() const { return m_IsNonUniform; }
+
+		/**
+		 * Set the storage class of the variable.
+		 * This is used by global variables which are not blocks, like shared memory arrays.
+		 *
+		 * @param storageClass The storage class.
+		 */
+		void setStorageClass(const char* storageClass) { m_StorageClass = storageClass; }
+
+		/**
+		 * Set the precision policy of the data type.
+		 * The results of the operations recorded on this data type (as the left hand side) use this policy instead of the function's, and so do their results in turn.
+		 * Variables are also decorated with RelaxedPrecision if the policy allows it. Note that decorations which were already added are not removed.
+		 *
+		 * @param policy The precision policy.
+		 */
+		void setPrecisionPolicy(const PrecisionPolicy& policy)
+		{
+			m_PrecisionPolicy = policy;
+			if (!m_IsTemporary && m_BlockIdentifier.empty())
+				m_Source.decoratePrecision(m_VariableName, "OpVariable", TypeTraits<Derived>::Identifier, policy);
+		}
+
+		/**
+		 * Get the precision policy of the data type.
+		 * This is the current function's policy unless one was set using setPrecisionPolicy().
+		 *
+		 * @return The precision policy.
+		 */
+		[[nodiscard]] PrecisionPolicy getPrecisionPolicy() const { return m_PrecisionPolicy.value_or(m_Source.getCurrentFunctionBlock().m_PrecisionPolicy); }
+
+		/**
+		 * Get the identifier of the pointer to the variable.
+		 * If the data type is a block member, this records an access chain to it in the current function.
+		 *
+		 * @return The pointer identifier.
+		 */
+		[[nodiscard]] std::string getPointerIdentifier() const
+		{
+			if (m_BlockIdentifier.empty())
+				return getIdentifier();
+
+			m_Source.storeConstant(m_MemberIndex);
+			const auto pointerType = m_Source.template registerPointerType<Derived>(m_StorageClass);
+
+			// Elements of block arrays are selected before the member.
+			const auto elementIndex = m_BlockElementIndex.empty() ? std::string() : m_BlockElementIndex + " ";
+
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpAccessChain {} %{} {}%{}", identifier, pointerType, m_BlockIdentifier, elementIndex, GetConstantIdentifier(m_MemberIndex)));
+			decorateNonUniform(identifier);
+
+			return "%" + identifier;
+		}
+
+		/**
+		 * Get the identifier of the value of the variable.
+		 * Temporaries are already values, and the rest are loaded in the current function.
+		 *
+		 * @return The value identifier.
+		 */
+		[[nodiscard]] std::string getValueIdentifier() const
+		{
+			if (m_IsTemporary)
+				return getIdentifier();
+
+			const auto pointer = getPointerIdentifier();
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpLoad {} {}", identifier, TypeTraits<Derived>::Identifier, pointer));
+			m_Source.decoratePrecision(identifier, "OpLoad", TypeTraits<Derived>::Identifier, getPrecisionPolicy());
+			decorateNonUniform(identifier);
+
+			return "%" + identifier;
+		}
+
+		/**
+		 * Mark the data type as a temporary.
+		 * Temporaries are the results of operations (SSA values) and are not backed by a variable, so they cannot be stored to.
+		 */
+		void markTemporary() { m_IsTemporary = true; }
+
+		/**
+		 * Check if the data type is a temporary.
+		 *
+		 * @return True if the data type is a temporary.
+		 * @return False if the data type is a variable.
+		 */
+		[[nodiscard]] bool isTemporary() const { return m_IsTemporary; }
+
+		/**
+		 * Get the storage class of the variable.
+		 *
+		 * @return The storage class.
+		 */
+		[[nodiscard]] const char* getStorageClass() const { return m_StorageClass; }
+
 		/**
 		 * Get the source to which the instructions are written to.
 		 *
@@ -73,9 +212,124 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] const SPIRVSource& getSource() const { return m_Source; }
 
+		/**
+		 * Record an operation which results in a temporary.
+		 * The instruction is recorded in the current function as <result> = <instruction> <result type> <operands>.
+		 * The result is decorated using the precision policy of this data type and inherits it.
+		 *
+		 * @tparam Result The result type.
+		 * @param instruction The instruction name.
+		 * @param operands The operands of the instruction.
+		 * @return The resulting temporary.
+		 */
+		template<class Result>
+		[[nodiscard]] Result recordOperation(const char* instruction, const std::string& operands) const
+		{
+			m_Source.template registerType<Result>();
+
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = {} {} {}", identifier, instruction, TypeTraits<Result>::Identifier, operands));
+			m_Source.decoratePrecision(identifier, instruction, TypeTraits<Result>::Identifier, getPrecisionPolicy());
+
+			auto result = Result(m_Source, identifier);
+			result.markTemporary();
+
+			if (m_PrecisionPolicy)
+				result.setPrecisionPolicy(*m_PrecisionPolicy);
+
+			return result;
+		}
+
+		/**
+		 * Store a constant which is used along with this data type.
+		 *
+		 * @tparam Value The value type.
+		 * @param value The constant value.
+		 * @return The identifier of the constant.
+		 */
+		template<class Value>
+		[[nodiscard]] std::string storeConstant(const Value& value) const
+		{
+			m_Source.storeConstant(value);
+			return "%" + GetConstantIdentifier(value);
+		}
+
+	protected:
+		/**
+		 * Copy the value of another data type to this variable.
+		 * Temporaries are stored directly, while variables are copied memory to memory.
+		 *
+		 * @param other The other data type.
+		 */
+		void copyFrom(const DataType& other)
+		{
+			if (other.m_IsTemporary)
+				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore {} {}", getPointerIdentifier(), other.getIdentifier()));
+
+			else
+				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpCopyMemory {} {}", getPointerIdentifier(), other.getPointerIdentifier()));
+		}
+
+		/**
+		 * Store a constant composite to this variable.
+		 * The identifier will be composite_<type identifier>_<hash of the values>.
+		 *
+		 * @tparam Value The value type.
+		 * @tparam Values The rest of the value types.
+		 * @param value The first component value.
+		 * @param values The rest of the component values.
+		 */
+		template<class Value, class... Values>
+		void storeConstantComposite(Value value, Values... values)
+		{
+			const Value components[] = { value, static_cast<Value>(values)... };
+			const auto identifier = fmt::format("%composite_{}_{}", TypeTraits<Derived>::RawIdentifier, GenerateHash(components, sizeof(components)));
+
+			auto constituents = storeConstant(value);
+			((constituents += " " + storeConstant(static_cast<Value>(values))), ...);
+
+			m_Source.insertType(fmt::format("{} = OpConstantComposite {} {}", identifier, TypeTraits<Derived>::Identifier, constituents));
+
+			// Initialization happens only within function definitions, so we can simply assign it there.
+			m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore {} {}", getPointerIdentifier(), identifier));
+		}
+
+		/**
+		 * Construct the value of this variable from its constituents and store it.
+		 * Vector constituents are expanded by the instruction itself, so no component has to be extracted beforehand.
+		 *
+		 * @param constituents The constituent identifiers.
+		 */
+		void storeComposite(const std::string& constituents)
+		{
+			const auto composite = recordOperation<Derived>("OpCompositeConstruct", constituents);
+			m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore {} {}", getPointerIdentifier(), composite.getIdentifier()));
+		}
+
+		/**
+		 * Decorate a pointer or a value derived from this data type with NonUniform, if the data type is non-uniform.
+		 *
+		 * @param identifier The identifier to decorate, without the leading %.
+		 */
+		void decorateNonUniform(const std::string& identifier) const
+		{
+			if (m_IsNonUniform)
+				m_Source.insertAnnotation(fmt::format("OpDecorate %{} NonUniform", identifier));
+		}
+
 	protected:
 		std::string m_VariableName;
+		std::string m_BlockIdentifier;
+		std::string m_BlockElementIndex;
 		SPIRVSource& m_Source;
+
+		std::optional<PrecisionPolicy> m_PrecisionPolicy;
+
+		const char* m_StorageClass = "Function";
+		uint32_t m_MemberIndex = 0;
+
+		bool m_IsTemporary = false;
+		bool m_IsNonUniform = false;
 	};
 
 	/**
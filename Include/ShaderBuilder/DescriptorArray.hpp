@@ -0,0 +1,162 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Scalar.hpp"
+
+#include <array>
+#include <tuple>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Non-uniform index structure.
+	 * This marks an index which might not be the same for all the invocations, so the accessed resource must be decorated with NonUniform.
+	 * Use NonUniform() to create one.
+	 */
+	struct NonUniformIndex final
+	{
+		Scalar<uint32_t> m_Index;
+	};
+
+	/**
+	 * Mark an index as non-uniform.
+	 * This is the same as GLSL's nonuniformEXT().
+	 *
+	 * @param index The index.
+	 * @return The non-uniform index.
+	 */
+	[[nodiscard]] inline NonUniformIndex NonUniform(const Scalar<uint32_t>& index)
+	{
+		auto copy = index.recordOperation<Scalar<uint32_t>>("OpCopyObject", index.getValueIdentifier());
+		copy.getSource().insertAnnotation(fmt::format("OpDecorate {} NonUniform", copy.getIdentifier()));
+
+		return NonUniformIndex{ copy };
+	}
+
+	/**
+	 * Descriptor array class.
+	 * This is an array of uniform or storage blocks which share a single binding, so a block can be selected per draw or per invocation without rebinding
+	 * any descriptors. Arrays without a length are runtime sized, and their length is decided by the descriptor set layout.
+	 *
+	 * For example,
+	 *
+	 * ```c++
+	 * auto materials = builder.createUniformArray<Material>(1, 0, 0, &Material::Color);
+	 * auto color = materials[NonUniform(materialIndex)].Color;
+	 * ```
+	 *
+	 * @tparam Type The block type.
+	 * @tparam Members The block's member pointers.
+	 */
+	template<class Type, class... Members>
+	class DescriptorArray final
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param identifier The identifier of the array variable.
+		 * @param storageClass The storage class of the array variable.
+		 * @param memberIndices The indices of the members in the block, in the same order as the members.
+		 * @param members The members of the block.
+		 */
+		explicit DescriptorArray(SPIRVSource& source, const std::string& identifier, const char* storageClass, const std::array<uint32_t, sizeof...(Members)>& memberIndices, Members... members)
+			: m_Source(source), m_Identifier(identifier), m_StorageClass(storageClass), m_MemberIndices(memberIndices), m_Members(members...) {}
+
+		/**
+		 * Access a block of the array.
+		 *
+		 * @param index The index of the block.
+		 * @return The block.
+		 */
+		[[nodiscard]] Type operator[](uint32_t index)
+		{
+			m_Source.storeConstant(index);
+			return getElement(fmt::format("%{}", GetConstantIdentifier(index)), false);
+		}
+
+		/**
+		 * Access a block of the array using an index computed in the shader.
+		 * The index must be dynamically uniform, meaning that it must be the same for all the invocations of a draw or a dispatch. Use NonUniform() otherwise.
+		 *
+		 * @param index The index of the block.
+		 * @return The block.
+		 */
+		[[nodiscard]] Type operator[](const Scalar<uint32_t>& index)
+		{
+			m_Source.insertCapability(isStorageBuffer() ? "OpCapability StorageBufferArrayDynamicIndexing" : "OpCapability UniformBufferArrayDynamicIndexing");
+			return getElement(index.getValueIdentifier(), false);
+		}
+
+		/**
+		 * Access a block of the array using an index which can be different for each invocation.
+		 *
+		 * @param index The non-uniform index of the block.
+		 * @return The block. Its members are decorated with NonUniform when they are accessed.
+		 */
+		[[nodiscard]] Type operator[](const NonUniformIndex& index)
+		{
+			m_Source.insertCapability("OpCapability ShaderNonUniform");
+			m_Source.insertCapability(isStorageBuffer() ? "OpCapability StorageBufferArrayNonUniformIndexing" : "OpCapability UniformBufferArrayNonUniformIndexing");
+			m_Source.insertExtension("OpExtension \"SPV_EXT_descriptor_indexing\"");
+
+			return getElement(index.m_Index.getValueIdentifier(), true);
+		}
+
+		/**
+		 * Get the name of the array variable.
+		 * This is used to look up the block layout, which is shared by all the blocks.
+		 *
+		 * @return The name.
+		 */
+		[[nodiscard]] const std::string& getName() const { return m_Identifier; }
+
+	private:
+		/**
+		 * Check if the array contains storage buffers.
+		 *
+		 * @return True if the array contains storage buffers.
+		 * @return False if the array contains uniform buffers.
+		 */
+		[[nodiscard]] bool isStorageBuffer() const { return std::string_view(m_StorageClass) == "StorageBuffer"; }
+
+		/**
+		 * Get a block of the array using the index identifier.
+		 * The block's members are bound to the selected element, so accessing them records an access chain through the array.
+		 *
+		 * @param indexIdentifier The identifier of the index.
+		 * @param isNonUniform Whether the index is non-uniform.
+		 * @return The block.
+		 */
+		[[nodiscard]] Type getElement(const std::string& indexIdentifier, bool isNonUniform)
+		{
+			auto block = Type(m_Source, m_Identifier);
+			auto bindMembers = [this, &block, &indexIdentifier, isNonUniform](auto... members)
+			{
+				uint32_t i = 0;
+				auto bindMember = [this, &block, &indexIdentifier, isNonUniform, &i](auto member)
+				{
+					auto& variable = block.*member;
+					variable.bindToBlockElement(m_Identifier, indexIdentifier, m_MemberIndices[i++], m_StorageClass);
+
+					if (isNonUniform)
+						variable.markNonUniform();
+				};
+				(bindMember(members), ...);
+			};
+			std::apply(bindMembers, m_Members);
+
+			return block;
+		}
+
+	private:
+		SPIRVSource& m_Source;
+		std::string m_Identifier;
+		const char* m_StorageClass;
+
+		std::array<uint32_t, sizeof...(Members)> m_MemberIndices;
+		std::tuple<Members...> m_Members;
+	};
+} // namespace ShaderBuilder
@@ -0,0 +1,208 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Vec2.hpp"
+#include "Layout.hpp"
+
+#include <numeric>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Device pointer class.
+	 * This is a pointer to a buffer's device address (PhysicalStorageBuffer), which can be passed around in blocks and used without any descriptors.
+	 * The shader must use the PhysicalStorageBuffer64 addressing model (see Configuration). The required capability is inserted automatically.
+	 *
+	 * For example,
+	 *
+	 * ```c++
+	 * auto vertices = ToDevicePointer<Vec4<float>>(pushConstant.VertexAddress);
+	 * auto position = vertices[vertexIndex].load();
+	 * ```
+	 *
+	 * @tparam Type The type the pointer points to. This must be a scalar or a vector.
+	 */
+	template<class Type>
+	class DevicePointer final : public DataType<DevicePointer<Type>>
+	{
+		static_assert(IsScalarType<Type> || IsVectorType<Type>, "Device pointers can only point to scalars and vectors!");
+
+	public:
+		using Super = DataType<DevicePointer<Type>>;
+
+		// The default alignment of the pointed data, using the std430 rules.
+		static constexpr uint32_t DefaultAlignment = TypeLayout<Type>::alignment(LayoutRule::Std430);
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param alignment The alignment of the pointed data in bytes. Default is the std430 alignment of the type.
+		 */
+		explicit DevicePointer(SPIRVSource& source, const std::string& variableName, uint32_t alignment = DefaultAlignment) : Super(source, variableName), m_Alignment(alignment) {}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param other The other to copy the data from.
+		 * @param shallow Whether we need a shallow copy or not. Default is false. If a shallow copy is performed, no instructions are recorded.
+		 */
+		explicit DevicePointer(SPIRVSource& source, const std::string& variableName, const DevicePointer& other, bool shallow = false) : Super(source, variableName), m_Alignment(other.m_Alignment)
+		{
+			// If we just need a shallow copy, return without storing any instructions.
+			if (shallow)
+				return;
+
+			Super::copyFrom(other);
+		}
+
+		/**
+		 * Assignment operator.
+		 *
+		 * @param other The other pointer.
+		 * @return The altered pointer reference.
+		 */
+		DevicePointer& operator=(const DevicePointer& other)
+		{
+			Super::copyFrom(other);
+			m_Alignment = other.m_Alignment;
+
+			return *this;
+		}
+
+		/**
+		 * Load the pointed value.
+		 *
+		 * @return The loaded temporary.
+		 */
+		[[nodiscard]] Type load() const
+		{
+			return Super::template recordOperation<Type>("OpLoad", fmt::format("{} Aligned {}", Super::getValueIdentifier(), m_Alignment));
+		}
+
+		/**
+		 * Store a value to the pointed memory.
+		 *
+		 * @param value The value to store.
+		 */
+		void store(const Type& value)
+		{
+			const auto valueIdentifier = value.getValueIdentifier();
+			Super::m_Source.insertInstruction(fmt::format("OpStore {} {} Aligned {}", Super::getValueIdentifier(), valueIdentifier, m_Alignment));
+		}
+
+		/**
+		 * Offset the pointer by a number of elements, like pointer arithmetic in C.
+		 *
+		 * @param index The number of elements to offset by.
+		 * @return The offset pointer.
+		 */
+		[[nodiscard]] DevicePointer operator[](uint32_t index) const { return offset(Super::storeConstant(index)); }
+
+		/**
+		 * Offset the pointer by a number of elements computed in the shader, like pointer arithmetic in C.
+		 *
+		 * @param index The number of elements to offset by.
+		 * @return The offset pointer.
+		 */
+		[[nodiscard]] DevicePointer operator[](const Scalar<uint32_t>& index) const { return offset(index.getValueIdentifier()); }
+
+		/**
+		 * Get the alignment of the pointed data.
+		 *
+		 * @return The alignment in bytes.
+		 */
+		[[nodiscard]] uint32_t getAlignment() const { return m_Alignment; }
+
+		/**
+		 * Set the alignment of the pointed data.
+		 * This is used by the loads and stores, so it should not be larger than the actual alignment.
+		 *
+		 * @param alignment The alignment in bytes.
+		 */
+		void setAlignment(uint32_t alignment) { m_Alignment = alignment; }
+
+	private:
+		/**
+		 * Offset the pointer using the identifier of the element count.
+		 * The offset element is only aligned to the common alignment of the pointer and the stride.
+		 *
+		 * @param indexIdentifier The identifier of the index.
+		 * @return The offset pointer.
+		 */
+		[[nodiscard]] DevicePointer offset(const std::string& indexIdentifier) const
+		{
+			auto pointer = Super::template recordOperation<DevicePointer>("OpPtrAccessChain", fmt::format("{} {}", Super::getValueIdentifier(), indexIdentifier));
+			pointer.setAlignment(std::gcd(m_Alignment, TypeTraits<DevicePointer>::Stride));
+
+			return pointer;
+		}
+
+	private:
+		uint32_t m_Alignment = DefaultAlignment;
+	};
+
+	/**
+	 * Device pointer type traits.
+	 * The stride is decorated on the pointer type so it can be offset using OpPtrAccessChain.
+	 *
+	 * @tparam PointeeType The type the pointer points to.
+	 */
+	template<class PointeeType>
+	struct TypeTraits<DevicePointer<PointeeType>>
+	{
+		using Type = DevicePointer<PointeeType>;
+		using ValueTraits = TypeTraits<PointeeType>;
+		static constexpr auto& RawIdentifier = StaticString<ConcatenateStrings("device_pointer_", ValueTraits::RawIdentifier)>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypePointer PhysicalStorageBuffer ", ValueTraits::Identifier)>;
+		static constexpr uint32_t Stride = AlignOffset(TypeLayout<PointeeType>::size(LayoutRule::Std430), TypeLayout<PointeeType>::alignment(LayoutRule::Std430));
+		static constexpr uint8_t Size = sizeof(uint64_t);
+	};
+
+	/**
+	 * Is device pointer type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsDevicePointerType<DevicePointer<Type>> = true;
+
+	/**
+	 * Convert a 64 bit device address to a device pointer.
+	 *
+	 * @tparam Type The type the pointer points to.
+	 * @param address The device address.
+	 * @param alignment The alignment of the pointed data in bytes. Default is the std430 alignment of the type.
+	 * @return The device pointer.
+	 */
+	template<class Type>
+	[[nodiscard]] DevicePointer<Type> ToDevicePointer(const Scalar<uint64_t>& address, uint32_t alignment = DevicePointer<Type>::DefaultAlignment)
+	{
+		auto pointer = address.template recordOperation<DevicePointer<Type>>("OpConvertUToPtr", address.getValueIdentifier());
+		pointer.setAlignment(alignment);
+
+		return pointer;
+	}
+
+	/**
+	 * Convert a device address stored as two 32 bit unsigned integers to a device pointer.
+	 * This does not require 64 bit integer support. The lower 32 bits are stored in the x component.
+	 *
+	 * @tparam Type The type the pointer points to.
+	 * @param address The device address.
+	 * @param alignment The alignment of the pointed data in bytes. Default is the std430 alignment of the type.
+	 * @return The device pointer.
+	 */
+	template<class Type>
+	[[nodiscard]] DevicePointer<Type> ToDevicePointer(const Vec2<uint32_t>& address, uint32_t alignment = DevicePointer<Type>::DefaultAlignment)
+	{
+		auto pointer = address.template recordOperation<DevicePointer<Type>>("OpBitcast", address.getValueIdentifier());
+		pointer.setAlignment(alignment);
+
+		return pointer;
+	}
+} // namespace ShaderBuilder
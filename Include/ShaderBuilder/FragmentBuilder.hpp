@@ -0,0 +1,231 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Builder.hpp"
+#include "BuilderError.hpp"
+#include "Vec4.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Interpolation flags enum.
+	 * These define how a fragment input is interpolated across the primitive.
+	 */
+	enum class Interpolation : uint8_t
+	{
+		Smooth = 0,
+		Flat = 1 << 0,
+		NoPerspective = 1 << 1,
+		Centroid = 1 << 2,
+		Sample = 1 << 3
+	};
+
+	[[nodiscard]] constexpr Interpolation operator|(Interpolation lhs, Interpolation rhs) { return static_cast<Interpolation>(static_cast<std::underlying_type_t<Interpolation>>(lhs) | static_cast<std::underlying_type_t<Interpolation>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(Interpolation lhs, Interpolation rhs) { return static_cast<std::underlying_type_t<Interpolation>>(lhs) & static_cast<std::underlying_type_t<Interpolation>>(rhs); }
+
+	/**
+	 * Depth mode enum.
+	 * This tells the driver how the written depth relates to the interpolated depth, so it can keep the early depth tests which would otherwise be disabled.
+	 */
+	enum class DepthMode : uint8_t
+	{
+		Any,
+		Greater,
+		Less,
+		Unchanged
+	};
+
+	/**
+	 * Fragment function builder class.
+	 * This contains the fragment shader specific code that can be accessed by a fragment shader.
+	 */
+	class FragmentFunctionBuilder final : public FunctionBuilder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The SPIRV source.
+		 */
+		explicit FragmentFunctionBuilder(SPIRVSource& source) : FunctionBuilder(source) {}
+
+		/**
+		 * Get the fragment coordinate.
+		 * This contains the window position in x and y, the depth in z and 1/w in w.
+		 *
+		 * @return The fragment coordinate.
+		 */
+		[[nodiscard]] Vec4<float> getFragCoord() { return getBuiltIn<Vec4<float>>("FragCoord"); }
+
+		/**
+		 * Check if the fragment belongs to a front facing primitive.
+		 *
+		 * @return True if the primitive is front facing.
+		 */
+		[[nodiscard]] Scalar<bool> isFrontFacing() { return getBuiltIn<Scalar<bool>>("FrontFacing"); }
+
+		/**
+		 * Check if the invocation is a helper invocation.
+		 * Helper invocations only exist to compute the derivatives, and their writes to memory are discarded.
+		 *
+		 * @return True if the invocation is a helper invocation.
+		 */
+		[[nodiscard]] Scalar<bool> helperInvocation()
+		{
+			// The value can change when other invocations are discarded, so SPIR-V 1.6 requires it to be volatile.
+			m_Source.insertAnnotation("OpDecorate %gl_HelperInvocation Volatile");
+			return getBuiltIn<Scalar<bool>>("HelperInvocation");
+		}
+
+		/**
+		 * Set the depth of the fragment.
+		 * Writing the depth disables the early depth tests unless the depth mode tells the driver how it changes (see FragmentBuilder::setDepthMode()).
+		 *
+		 * @param depth The depth to set.
+		 */
+		void setDepth(const Scalar<float>& depth);
+
+		/**
+		 * Discard the fragment.
+		 * This terminates the invocation, so nothing after it is executed. This is the same as GLSL's discard.
+		 */
+		void discard();
+	};
+
+	/**
+	 * Fragment builder class.
+	 * This contains the execution modes and the interpolated inputs of a fragment shader.
+	 */
+	class FragmentBuilder final : public Builder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
+		 */
+		explicit FragmentBuilder(Configuration config = Configuration()) : Builder(config) {}
+
+		/**
+		 * Create a new function.
+		 *
+		 * Note that the instructions will be recorded only in the first run.
+		 *
+		 * @tparam Lambda The lambda type.
+		 * @param function The function definition. Make sure that the function's first parameter/ argument is FunctionBuilder&.
+		 * @param control The function control flags. Default is None.
+		 * @return The function.
+		 */
+		template<class Lambda>
+		[[nodiscard]] decltype(auto) createFunction(Lambda&& function, FunctionControl control = FunctionControl::None) { return Function<std::decay_t<Lambda>>(m_Source, std::forward<Lambda>(function), control); }
+
+		/**
+		 * Create a new interpolated input.
+		 * Integer and double inputs cannot be interpolated, so they are always flat.
+		 *
+		 * @tparam Type The type of the variable.
+		 * @param location The input location.
+		 * @param interpolation The interpolation flags. Default is Smooth.
+		 * @return The created variable.
+		 */
+		template<class Type>
+		[[nodiscard]] Input<Type> createInput(uint32_t location, Interpolation interpolation = Interpolation::Smooth)
+		{
+			using Value = typename TypeTraits<Type>::ValueTraits::Type;
+			if constexpr (std::is_integral_v<Value> || std::is_same_v<Value, double>)
+				interpolation = interpolation | Interpolation::Flat;
+
+			auto input = Builder::createInput<Type>(location);
+			insertInterpolation(input.getName(), interpolation);
+
+			return input;
+		}
+
+		/**
+		 * Create a new per-primitive input.
+		 * This reads a per-primitive output of a mesh shader (see MeshBuilder::createPrimitiveOutput()), which is the same for all the fragments of a primitive,
+		 * so it is never interpolated.
+		 *
+		 * @tparam Type The type of the variable.
+		 * @param location The input location.
+		 * @return The created variable.
+		 */
+		template<class Type>
+		[[nodiscard]] Input<Type> createPerPrimitiveInput(uint32_t location)
+		{
+			m_Source.insertCapability("OpCapability MeshShadingEXT");
+			m_Source.insertExtension("OpExtension \"SPV_EXT_mesh_shader\"");
+
+			auto input = createInput<Type>(location, Interpolation::Flat);
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} PerPrimitiveEXT", input.getName()));
+
+			return input;
+		}
+
+		/**
+		 * Force the depth and stencil tests to run before the fragment shader.
+		 * The shader's depth writes and discards no longer affect the tests, so this should only be used when it doesn't change the result.
+		 *
+		 * @param enable Whether to enable the early tests. Default is true.
+		 */
+		void setEarlyFragmentTests(bool enable = true) { m_EarlyFragmentTests = enable; }
+
+		/**
+		 * Set how the shader changes the depth.
+		 * This is only used if the shader writes the depth.
+		 *
+		 * @param mode The depth mode.
+		 */
+		void setDepthMode(DepthMode mode) { m_DepthMode = mode; }
+
+		/**
+		 * Add an entry point to the shader.
+		 * Note that this will record the entry point function if it hasn't been recorded already.
+		 *
+		 * @tparam FunctionType The function type.
+		 * @tparam Attributes The input and output attribute types.
+		 * @param function The entry point function. Make sure that the return type is void and there are no parameters.
+		 * @param attributes The input and output attributes. The used built-ins are added automatically.
+		 */
+		template<class FunctionType, class... Attributes>
+		void addEntryPoint(FunctionType& function, const Attributes&... attributes)
+		{
+			// Validate the entry point and record it.
+			if constexpr (FunctionType::ParameterCount > 0 || !std::is_void_v<typename FunctionType::ReturnType>)
+				throw BuilderError("Entry points should not have any parameters and the return type should be void!");
+
+			else
+				function.record();
+
+			// Setup the inputs.
+			std::string attributeString;
+			auto insertAttribute = [&attributeString](const auto& attribute) { attributeString += fmt::format(" %{}", attribute.getName()); };
+			(insertAttribute(attributes), ...);
+
+			const auto& name = function.getName();
+			m_Source.insertEntryPoint(fmt::format("OpEntryPoint Fragment %{} \"{}\"{}{}", name, name, attributeString, m_Source.getInterfaceVariables()));
+			insertExecutionModes(name);
+		}
+
+	private:
+		/**
+		 * Insert the interpolation decorations of an input.
+		 *
+		 * @param identifier The identifier of the input.
+		 * @param interpolation The interpolation flags.
+		 */
+		void insertInterpolation(const std::string& identifier, Interpolation interpolation);
+
+		/**
+		 * Insert the execution modes of an entry point.
+		 *
+		 * @param name The name of the entry point function.
+		 */
+		void insertExecutionModes(const std::string& name);
+
+	private:
+		DepthMode m_DepthMode = DepthMode::Any;
+		bool m_EarlyFragmentTests = false;
+	};
+} // namespace ShaderBuilder
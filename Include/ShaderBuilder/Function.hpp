@@ -3,70 +3,146 @@
 #pragma once
 
 #include "FunctionBuilder.hpp"
+#include "BuilderError.hpp"
 
-#include <functional>
+#include <tuple>
 
 namespace ShaderBuilder
 {
+	/**
+	 * Function signature structure.
+	 * This deduces the signature of a callable (like a lambda) from its call operator.
+	 *
+	 * @tparam Callable The callable type.
+	 */
+	template<class Callable>
+	struct FunctionSignature : FunctionSignature<decltype(&Callable::operator())> {};
+
+	/**
+	 * Function signature specialization for free functions.
+	 *
+	 * @tparam Return The return type.
+	 * @tparam Arguments The argument types.
+	 */
+	template<class Return, class... Arguments>
+	struct FunctionSignature<Return(*)(Arguments...)>
+	{
+		using Type = Return(Arguments...);
+	};
+
+	/**
+	 * Function signature specialization for mutable call operators.
+	 *
+	 * @tparam Class The class type.
+	 * @tparam Return The return type.
+	 * @tparam Arguments The argument types.
+	 */
+	template<class Class, class Return, class... Arguments>
+	struct FunctionSignature<Return(Class::*)(Arguments...)> : FunctionSignature<Return(*)(Arguments...)> {};
+
+	/**
+	 * Function signature specialization for const call operators.
+	 *
+	 * @tparam Class The class type.
+	 * @tparam Return The return type.
+	 * @tparam Arguments The argument types.
+	 */
+	template<class Class, class Return, class... Arguments>
+	struct FunctionSignature<Return(Class::*)(Arguments...) const> : FunctionSignature<Return(*)(Arguments...)> {};
+
 	/**
 	 * Function class.
 	 * This stores a single user-defined shader function and will be used for both calling and recording instructions.
 	 *
+	 * @tparam Callable The callable type which defines the function.
+	 * @tparam Signature The signature of the callable. This is deduced from the callable.
+	 */
+	template<class Callable, class Signature = typename FunctionSignature<Callable>::Type>
+	class Function;
+
+	/**
+	 * Function class.
+	 * The callable is stored as is, so calling and recording it does not go through any type erasure.
+	 *
+	 * @tparam Callable The callable type which defines the function.
+	 * @tparam FunctionBuilderType The function builder type.
 	 * @tparam Return The return type.
 	 * @tparam Parameters The parameter types.
 	 */
-	template<class FunctionBuilderType, class Return, class...Parameters>
-	class Function final : public DataType<Function<FunctionBuilderType, Return, Parameters...>>
+	template<class Callable, class FunctionBuilderType, class Return, class...Parameters>
+	class Function<Callable, Return(FunctionBuilderType&, Parameters...)> final : public DataType<Function<Callable, Return(FunctionBuilderType&, Parameters...)>>
 	{
 	public:
-		using Super = DataType<Function<FunctionBuilderType, Return, Parameters...>>;
-		using FunctionType = std::function<Return(FunctionBuilderType&, Parameters...)>;
+		using Super = DataType<Function<Callable, Return(FunctionBuilderType&, Parameters...)>>;
 		using ReturnType = Return;
 
 		static constexpr uint32_t ParameterCount = sizeof...(Parameters);
+		static constexpr bool IsDeclaration = false;
 
 	public:
 		/**
 		 * Explicit constructor.
+		 *
+		 * @param source The source to record the instructions to.
+		 * @param function The function definition.
+		 * @param control The function control flags. Default is None.
 		 */
-		explicit Function(SPIRVSource& source, FunctionType&& function) : Super(source, source.getUniqueIdentifier()), m_Builder(source), m_Function(std::move(function))
+		explicit Function(SPIRVSource& source, Callable function, FunctionControl control = FunctionControl::None) : Super(source, source.getUniqueIdentifier()), m_Builder(source), m_Function(std::move(function)), m_Control(control)
 		{
-			Super::m_Source.registerCallable<Return, Parameters...>();
+			if (control & FunctionControl::Inline && control & FunctionControl::DontInline)
+				throw BuilderError("A function cannot be both Inline and DontInline!");
+
+			Super::m_Source.template registerCallable<Return, Parameters...>();
 			Super::m_Source.insertName(fmt::format("OpName %{} \"{}\"", Super::m_VariableName, Super::m_VariableName));
 		}
 
 		/**
-		 * Call the function.
+		 * Record the function.
+		 * The body is recorded only once, using placeholder arguments as the parameters. Later calls only refer to the recorded function, so the user-defined body is never run again.
 		 */
-		Return operator()(Parameters... arguments)
+		void record()
 		{
-			if (m_Builder.isRecording())
-			{
-				auto& block = Super::m_Source.getCurrentFunctionBlock();
-				block.m_Name = Super::m_VariableName;
-				block.m_Definition.insert(fmt::format("%{} = OpFunction {} None {}", Super::m_VariableName, TypeTraits<Return>::Identifier, Super::m_Source.getFunctionIdentifier<Return, Parameters...>()));
-			}
+			if (m_IsRecorded)
+				return;
+
+			m_IsRecorded = true;
+
+			auto& block = Super::m_Source.pushFunctionBlock();
+			block.m_Name = Super::m_VariableName;
+			block.m_Definition.insert(fmt::format("%{} = OpFunction {} {} {}", Super::m_VariableName, TypeTraits<Return>::Identifier, GetFunctionControlString(m_Control), Super::m_Source.template getFunctionIdentifier<Return, Parameters...>()));
+
+			// The tuple is brace initialized so that the parameters are declared in order.
+			auto body = [this](Parameters... parameters) { return m_Function(m_Builder, std::move(parameters)...); };
+			auto parameters = std::tuple<Parameters...>{ Parameters(typename TypeTraits<Parameters>::Type(Super::m_Source, Super::m_Source.getUniqueIdentifier()))... };
 
 			if constexpr (std::is_void_v<Return>)
 			{
-				m_Function(m_Builder, arguments...);
-				m_Builder.exit();
-				m_Builder.toggleRecording();
-
+				std::apply(body, std::move(parameters));
+				m_Builder.finish();
 			}
 
 			else
-			{
-				auto ret = m_Function(m_Builder, arguments...);
-				m_Builder.exit(ret);
-				m_Builder.toggleRecording();
-
-				return ret;
-			}
+				m_Builder.finish(std::apply(body, std::move(parameters)));
 		}
 
+		/**
+		 * Record the function.
+		 * Calls from other functions should go through FunctionBuilder::call.
+		 */
+		void operator()() { record(); }
+
+		/**
+		 * Get the function control flags.
+		 *
+		 * @return The function control flags.
+		 */
+		[[nodiscard]] FunctionControl getFunctionControl() const { return m_Control; }
+
 	private:
 		FunctionBuilderType m_Builder;
-		FunctionType m_Function;
+		Callable m_Function;
+
+		FunctionControl m_Control = FunctionControl::None;
+		bool m_IsRecorded = false;
 	};
 }
\ No newline at end of file
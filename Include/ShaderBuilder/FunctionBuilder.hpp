@@ -2,7 +2,9 @@
 
 #pragma once
 
-#include "DataType.hpp"
+#include "Operations.hpp"
+#include "Vec4.hpp"
+#include "DevicePointer.hpp"
 
 namespace ShaderBuilder
 {
@@ -15,6 +17,241 @@ namespace ShaderBuilder
 	template<class Type>
 	struct FunctionBuilderReturnType {};
 
+	/**
+	 * Function control flags enum.
+	 * These are hints to the driver on how to treat a function.
+	 */
+	enum class FunctionControl : uint8_t
+	{
+		None = 0,
+		Inline = 1 << 0,
+		DontInline = 1 << 1,
+		Pure = 1 << 2,
+		Const = 1 << 3
+	};
+
+	[[nodiscard]] constexpr FunctionControl operator|(FunctionControl lhs, FunctionControl rhs) { return static_cast<FunctionControl>(static_cast<std::underlying_type_t<FunctionControl>>(lhs) | static_cast<std::underlying_type_t<FunctionControl>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(FunctionControl lhs, FunctionControl rhs) { return static_cast<std::underlying_type_t<FunctionControl>>(lhs) & static_cast<std::underlying_type_t<FunctionControl>>(rhs); }
+
+	/**
+	 * Get the function control string.
+	 *
+	 * @param control The function control flags.
+	 * @return The function control string, like "Inline|Pure".
+	 */
+	[[nodiscard]] std::string GetFunctionControlString(FunctionControl control);
+
+	/**
+	 * Selection control flags enum.
+	 * These tell the driver whether to flatten a conditional into straight line code or to keep the branch.
+	 */
+	enum class SelectionControl : uint8_t
+	{
+		None = 0,
+		Flatten = 1 << 0,
+		DontFlatten = 1 << 1
+	};
+
+	[[nodiscard]] constexpr SelectionControl operator|(SelectionControl lhs, SelectionControl rhs) { return static_cast<SelectionControl>(static_cast<std::underlying_type_t<SelectionControl>>(lhs) | static_cast<std::underlying_type_t<SelectionControl>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(SelectionControl lhs, SelectionControl rhs) { return static_cast<std::underlying_type_t<SelectionControl>>(lhs) & static_cast<std::underlying_type_t<SelectionControl>>(rhs); }
+
+	/**
+	 * Get the selection control string.
+	 *
+	 * @param control The selection control flags.
+	 * @return The selection control string.
+	 */
+	[[nodiscard]] std::string GetSelectionControlString(SelectionControl control);
+
+	/**
+	 * Loop control flags enum.
+	 * These trade the code size against the work done per iteration, by telling the driver how to unroll a loop.
+	 */
+	enum class LoopControl : uint8_t
+	{
+		None = 0,
+		Unroll = 1 << 0,
+		DontUnroll = 1 << 1,
+		DependencyInfinite = 1 << 2,
+		MaxIterations = 1 << 3
+	};
+
+	[[nodiscard]] constexpr LoopControl operator|(LoopControl lhs, LoopControl rhs) { return static_cast<LoopControl>(static_cast<std::underlying_type_t<LoopControl>>(lhs) | static_cast<std::underlying_type_t<LoopControl>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(LoopControl lhs, LoopControl rhs) { return static_cast<std::underlying_type_t<LoopControl>>(lhs) & static_cast<std::underlying_type_t<LoopControl>>(rhs); }
+
+	/**
+	 * Get the loop control string.
+	 *
+	 * @param control The loop control flags.
+	 * @param maxIterations The maximum number of iterations. This is used only if the MaxIterations flag is set.
+	 * @return The loop control string, like "Unroll|MaxIterations 16".
+	 */
+	[[nodiscard]] std::string GetLoopControlString(LoopControl control, uint32_t maxIterations);
+
+	/**
+	 * Scope enum.
+	 * This defines the set of invocations an operation, like a barrier, applies to.
+	 */
+	enum class Scope : uint8_t
+	{
+		CrossDevice = 0,
+		Device = 1,
+		Workgroup = 2,
+		Subgroup = 3,
+		Invocation = 4
+	};
+
+	/**
+	 * Memory semantics flags enum.
+	 * These define the memory ordering and the kinds of memory an operation synchronizes.
+	 */
+	enum class MemorySemantics : uint16_t
+	{
+		None = 0,
+		Acquire = 1 << 1,
+		Release = 1 << 2,
+		AcquireRelease = 1 << 3,
+		SequentiallyConsistent = 1 << 4,
+		UniformMemory = 1 << 6,
+		SubgroupMemory = 1 << 7,
+		WorkgroupMemory = 1 << 8,
+		CrossWorkgroupMemory = 1 << 9,
+		AtomicCounterMemory = 1 << 10,
+		ImageMemory = 1 << 11
+	};
+
+	[[nodiscard]] constexpr MemorySemantics operator|(MemorySemantics lhs, MemorySemantics rhs) { return static_cast<MemorySemantics>(static_cast<std::underlying_type_t<MemorySemantics>>(lhs) | static_cast<std::underlying_type_t<MemorySemantics>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(MemorySemantics lhs, MemorySemantics rhs) { return static_cast<std::underlying_type_t<MemorySemantics>>(lhs) & static_cast<std::underlying_type_t<MemorySemantics>>(rhs); }
+
+	/**
+	 * Get the semantics of a compare exchange operation when the values are not equal.
+	 * Nothing is written in this case, so the release semantics are dropped.
+	 *
+	 * @param semantics The semantics used when the values are equal.
+	 * @return The semantics used when the values are not equal.
+	 */
+	[[nodiscard]] MemorySemantics GetUnequalSemantics(MemorySemantics semantics);
+
+	/**
+	 * Group operation enum.
+	 * This defines how a subgroup arithmetic operation combines the values of the invocations.
+	 */
+	enum class GroupOperation : uint8_t
+	{
+		Reduce,
+		InclusiveScan,
+		ExclusiveScan
+	};
+
+	/**
+	 * Subgroup operation enum.
+	 */
+	enum class SubgroupOperation : uint8_t
+	{
+		Add,
+		Min,
+		Max
+	};
+
+	/**
+	 * Get the group operation string.
+	 *
+	 * @param operation The group operation.
+	 * @return The group operation string.
+	 */
+	[[nodiscard]] constexpr const char* GetGroupOperationString(GroupOperation operation)
+	{
+		switch (operation)
+		{
+		case GroupOperation::InclusiveScan:										return "InclusiveScan";
+		case GroupOperation::ExclusiveScan:										return "ExclusiveScan";
+		default:																return "Reduce";
+		}
+	}
+
+	/**
+	 * Get the subgroup arithmetic instruction for a value type.
+	 *
+	 * @tparam Value The value type of the operand.
+	 * @param operation The operation to perform.
+	 * @return The instruction name.
+	 */
+	template<class Value>
+	[[nodiscard]] constexpr const char* GetSubgroupInstruction(SubgroupOperation operation)
+	{
+		if constexpr (IsFloatingPoint<Value>)
+		{
+			switch (operation)
+			{
+			case SubgroupOperation::Add:										return "OpGroupNonUniformFAdd";
+			case SubgroupOperation::Min:										return "OpGroupNonUniformFMin";
+			default:															return "OpGroupNonUniformFMax";
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+			case SubgroupOperation::Add:										return "OpGroupNonUniformIAdd";
+			case SubgroupOperation::Min:										return std::is_signed_v<Value> ? "OpGroupNonUniformSMin" : "OpGroupNonUniformUMin";
+			default:															return std::is_signed_v<Value> ? "OpGroupNonUniformSMax" : "OpGroupNonUniformUMax";
+			}
+		}
+	}
+
+	/**
+	 * Atomic operation enum.
+	 */
+	enum class AtomicOperation : uint8_t
+	{
+		Add,
+		Min,
+		Max,
+		And,
+		Or,
+		Xor,
+		Exchange
+	};
+
+	/**
+	 * Get the atomic instruction for a value type.
+	 *
+	 * @tparam Value The value type of the operand.
+	 * @param operation The operation to perform.
+	 * @return The instruction name.
+	 */
+	template<class Value>
+	[[nodiscard]] constexpr const char* GetAtomicInstruction(AtomicOperation operation)
+	{
+		switch (operation)
+		{
+		case AtomicOperation::Add:												return "OpAtomicIAdd";
+		case AtomicOperation::Min:												return std::is_signed_v<Value> ? "OpAtomicSMin" : "OpAtomicUMin";
+		case AtomicOperation::Max:												return std::is_signed_v<Value> ? "OpAtomicSMax" : "OpAtomicUMax";
+		case AtomicOperation::And:												return "OpAtomicAnd";
+		case AtomicOperation::Or:												return "OpAtomicOr";
+		case AtomicOperation::Xor:												return "OpAtomicXor";
+		default:																return "OpAtomicExchange";
+		}
+	}
+
+	/**
+	 * Atomic target structure.
+	 * This resolves the value type of the memory an atomic operation is performed on.
+	 *
+	 * @tparam Target The target type. This is a scalar in memory, or a device pointer to one.
+	 */
+	template<class Target>
+	struct AtomicTarget { using Type = Target; };
+
+	/**
+	 * Atomic target structure specialization for device pointers.
+	 *
+	 * @tparam Pointee The type the pointer points to.
+	 */
+	template<class Pointee>
+	struct AtomicTarget<DevicePointer<Pointee>> { using Type = Pointee; };
+
 	/**
 	 * Function builder class.
 	 */
@@ -52,6 +289,11 @@ namespace ShaderBuilder
 				m_Source.insertType(fmt::format(FMT_STRING("%variable_type_{} = OpTypePointer Function {}"), TypeTraits<Type>::RawIdentifier, TypeTraits<Type>::Identifier));
 
 				m_Source.getCurrentFunctionBlock().m_Variables.insert(fmt::format("%{} = OpVariable %variable_type_{} Function", identifier, TypeTraits<Type>::RawIdentifier));
+				m_Source.decoratePrecision(identifier, "OpVariable", TypeTraits<Type>::Identifier, m_Source.getCurrentFunctionBlock().m_PrecisionPolicy);
+
+				// Variables holding device pointers must declare whether the pointed memory can be aliased.
+				if constexpr (IsDevicePointerType<Type>)
+					m_Source.insertAnnotation(fmt::format("OpDecorate %{} AliasedPointer", identifier));
 			}
 
 			return Type(m_Source, std::move(identifier), std::forward<Types>(initializer)...);
@@ -59,41 +301,387 @@ namespace ShaderBuilder
 
 		/**
 		 * Call a function from the builder.
+		 * The function is recorded on its first call, and every call records just the call instruction.
+		 * If inlining is enabled, small functions are inlined instead. Functions marked as Inline are inlined regardless of their size and the ones marked as DontInline are never inlined.
 		 *
 		 * @tparam FunctionType The function type to call.
 		 * @tparam Arguments The argument types.
 		 * @param function The function to call.
 		 * @param arguments The arguments to pass into the function.
-		 * @return The return from the function.
+		 * @return The returned temporary if the function returns a value.
 		 */
 		template<class FunctionType, class... Arguments>
-		decltype(auto) call(FunctionType& function, Arguments&&... arguments)
+		decltype(auto) call(FunctionType& function, const Arguments&... arguments)
 		{
-			const auto returnIdentifier = m_Source.getUniqueIdentifier();
-			if constexpr (sizeof...(Arguments) > 0)
+			using ReturnType = typename TypeTraits<typename FunctionType::ReturnType>::Type;
+			static_assert(sizeof...(Arguments) == FunctionType::ParameterCount, "The argument count does not match the function's parameter count!");
+
+			// Declarations (like imported functions) do not have a body to record.
+			if constexpr (!FunctionType::IsDeclaration)
+				function.record();
+
+			// Arguments are passed by value.
+			const std::vector<std::string> argumentIdentifiers = { arguments.getValueIdentifier()... };
+
+			std::optional<std::string> returnIdentifier;
+			if constexpr (!FunctionType::IsDeclaration)
 			{
-				std::string argumentString;
-				auto argumentToString = [&argumentString](const auto& argument) mutable
-				{
-					using ArgumentType = decltype(argument);
+				if (!(function.getFunctionControl() & FunctionControl::DontInline))
+					returnIdentifier = m_Source.inlineFunction(function.getName(), argumentIdentifiers, function.getFunctionControl() & FunctionControl::Inline);
+			}
 
-					argumentString += fmt::format("%{} ", argument.getName());
-				};
-				(argumentToString(arguments), ...);
+			if (!returnIdentifier)
+			{
+				std::string argumentString;
+				for (const auto& identifier : argumentIdentifiers)
+					argumentString += " " + identifier;
 
-				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpFunctionCall {} %{} {}", returnIdentifier, TypeTraits<typename FunctionType::ReturnType>::Identifier, function.getName(), argumentString));
+				returnIdentifier = m_Source.getUniqueIdentifier();
+				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpFunctionCall {} %{}{}", *returnIdentifier, TypeTraits<ReturnType>::Identifier, function.getName(), argumentString));
 			}
-			else
+
+			if constexpr (!std::is_void_v<ReturnType>)
 			{
-				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpFunctionCall {} %{}", returnIdentifier, TypeTraits<typename FunctionType::ReturnType>::Identifier, function.getName()));
+				auto result = ReturnType(m_Source, *returnIdentifier);
+				result.markTemporary();
+
+				return result;
 			}
+		}
 
-			m_Source.pushFunctionBlock();
-			return function(std::forward<Arguments>(arguments)...);
+		/**
+		 * Record a conditional block.
+		 *
+		 * @tparam Then The then block type.
+		 * @param condition The condition.
+		 * @param then The function which records the instructions to execute if the condition is true.
+		 * @param control The selection control flags. Default is None.
+		 */
+		template<class Then>
+		void ifThen(const Scalar<bool>& condition, Then&& then, SelectionControl control = SelectionControl::None)
+		{
+			const auto conditionIdentifier = condition.getValueIdentifier();
+			const auto thenLabel = m_Source.getUniqueIdentifier();
+			const auto mergeLabel = m_Source.getUniqueIdentifier();
+
+			m_Source.insertInstruction(fmt::format("OpSelectionMerge %{} {}", mergeLabel, GetSelectionControlString(control)));
+			m_Source.insertInstruction(fmt::format("OpBranchConditional {} %{} %{}", conditionIdentifier, thenLabel, mergeLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", thenLabel));
+			then();
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", mergeLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", mergeLabel));
+		}
+
+		/**
+		 * Record a conditional block with an alternative.
+		 *
+		 * @tparam Then The then block type.
+		 * @tparam Else The else block type.
+		 * @param condition The condition.
+		 * @param then The function which records the instructions to execute if the condition is true.
+		 * @param otherwise The function which records the instructions to execute if the condition is false.
+		 * @param control The selection control flags. Default is None.
+		 */
+		template<class Then, class Else>
+		void ifElse(const Scalar<bool>& condition, Then&& then, Else&& otherwise, SelectionControl control = SelectionControl::None)
+		{
+			const auto conditionIdentifier = condition.getValueIdentifier();
+			const auto thenLabel = m_Source.getUniqueIdentifier();
+			const auto elseLabel = m_Source.getUniqueIdentifier();
+			const auto mergeLabel = m_Source.getUniqueIdentifier();
+
+			m_Source.insertInstruction(fmt::format("OpSelectionMerge %{} {}", mergeLabel, GetSelectionControlString(control)));
+			m_Source.insertInstruction(fmt::format("OpBranchConditional {} %{} %{}", conditionIdentifier, thenLabel, elseLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", thenLabel));
+			then();
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", mergeLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", elseLabel));
+			otherwise();
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", mergeLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", mergeLabel));
+		}
+
+		/**
+		 * Record a loop which runs while a condition is true.
+		 * The condition is checked before every iteration.
+		 *
+		 * @tparam Condition The condition type.
+		 * @tparam Body The loop body type.
+		 * @param condition The function which records the condition and returns it as a Scalar<bool>.
+		 * @param body The function which records the loop body.
+		 * @param control The loop control flags. Default is None.
+		 * @param maxIterations The maximum number of iterations, used with the MaxIterations flag. Default is 0.
+		 */
+		template<class Condition, class Body>
+		void loop(Condition&& condition, Body&& body, LoopControl control = LoopControl::None, uint32_t maxIterations = 0)
+		{
+			recordLoop(std::forward<Condition>(condition), std::forward<Body>(body), [] {}, control, maxIterations);
+		}
+
+		/**
+		 * Record a loop over a range of integers.
+		 * The index starts at the begin value and is incremented by one until it reaches the end value.
+		 *
+		 * @tparam Integer The index type.
+		 * @tparam Body The loop body type.
+		 * @param begin The first index.
+		 * @param end The index to stop at. This is not included in the range.
+		 * @param body The function which records the loop body. It receives the index as a const Scalar<Integer>&.
+		 * @param control The loop control flags. Default is None.
+		 * @param maxIterations The maximum number of iterations, used with the MaxIterations flag. Default is 0.
+		 */
+		template<class Integer, class Body>
+		void forRange(Integer begin, std::type_identity_t<Integer> end, Body&& body, LoopControl control = LoopControl::None, uint32_t maxIterations = 0)
+		{
+			static_assert(std::is_integral_v<Integer>, "The range index must be an integer!");
+
+			auto index = createVariable<Scalar<Integer>>(begin);
+			recordLoop([&index, end] { return index < end; }, [&index, &body] { body(index); }, [&index] { index = index + Integer(1); }, control, maxIterations);
+		}
+
+		/**
+		 * Record a control barrier.
+		 * All the invocations in the execution scope wait until they reach this barrier.
+		 *
+		 * @param execution The execution scope.
+		 * @param memory The memory scope.
+		 * @param semantics The memory semantics.
+		 */
+		void controlBarrier(Scope execution, Scope memory, MemorySemantics semantics);
+
+		/**
+		 * Record a memory barrier.
+		 * This orders the memory accesses without waiting for the other invocations.
+		 *
+		 * @param memory The memory scope.
+		 * @param semantics The memory semantics.
+		 */
+		void memoryBarrier(Scope memory, MemorySemantics semantics);
+
+		/**
+		 * Elect a single invocation in the subgroup.
+		 *
+		 * @return True in the active invocation with the lowest ID.
+		 */
+		[[nodiscard]] Scalar<bool> subgroupElect() { return recordSubgroupOperation<Scalar<bool>>("GroupNonUniform", "OpGroupNonUniformElect"); }
+
+		/**
+		 * Get a bit mask of the invocations in the subgroup for which the predicate is true.
+		 *
+		 * @param predicate The predicate.
+		 * @return The bit mask, where the x component contains the invocations 0 to 31 and so on.
+		 */
+		[[nodiscard]] Vec4<uint32_t> subgroupBallot(const Scalar<bool>& predicate) { return recordSubgroupOperation<Vec4<uint32_t>>("GroupNonUniformBallot", "OpGroupNonUniformBallot", predicate.getValueIdentifier()); }
+
+		/**
+		 * Broadcast a value from one invocation to the whole subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to broadcast.
+		 * @param invocation The ID of the invocation to broadcast from.
+		 * @return The value of the given invocation.
+		 */
+		template<class Type>
+		[[nodiscard]] Type subgroupBroadcast(const Type& value, uint32_t invocation)
+		{
+			m_Source.storeConstant(invocation);
+			return recordSubgroupOperation<Type>("GroupNonUniformBallot", "OpGroupNonUniformBroadcast", fmt::format("{} %{}", value.getValueIdentifier(), GetConstantIdentifier(invocation)));
+		}
+
+		/**
+		 * Broadcast a value from the active invocation with the lowest ID to the whole subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to broadcast.
+		 * @return The value of the first active invocation.
+		 */
+		template<class Type>
+		[[nodiscard]] Type subgroupBroadcastFirst(const Type& value) { return recordSubgroupOperation<Type>("GroupNonUniformBallot", "OpGroupNonUniformBroadcastFirst", value.getValueIdentifier()); }
+
+		/**
+		 * Get the value of another invocation in the subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to read.
+		 * @param invocation The ID of the invocation to read from.
+		 * @return The value of the given invocation.
+		 */
+		template<class Type>
+		[[nodiscard]] Type subgroupShuffle(const Type& value, const Scalar<uint32_t>& invocation)
+		{
+			const auto valueIdentifier = value.getValueIdentifier();
+			return recordSubgroupOperation<Type>("GroupNonUniformShuffle", "OpGroupNonUniformShuffle", fmt::format("{} {}", valueIdentifier, invocation.getValueIdentifier()));
+		}
+
+		/**
+		 * Add the values of the active invocations in the subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to add.
+		 * @param operation Whether to reduce the whole subgroup or scan up to the current invocation. Default is Reduce.
+		 * @return The resulting value.
+		 */
+		template<class Type> requires IsArithmeticType<Type>
+		[[nodiscard]] Type subgroupAdd(const Type& value, GroupOperation operation = GroupOperation::Reduce) { return recordSubgroupArithmetic(SubgroupOperation::Add, value, operation); }
+
+		/**
+		 * Get the minimum of the values of the active invocations in the subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to compare.
+		 * @param operation Whether to reduce the whole subgroup or scan up to the current invocation. Default is Reduce.
+		 * @return The resulting value.
+		 */
+		template<class Type> requires IsArithmeticType<Type>
+		[[nodiscard]] Type subgroupMin(const Type& value, GroupOperation operation = GroupOperation::Reduce) { return recordSubgroupArithmetic(SubgroupOperation::Min, value, operation); }
+
+		/**
+		 * Get the maximum of the values of the active invocations in the subgroup.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to compare.
+		 * @param operation Whether to reduce the whole subgroup or scan up to the current invocation. Default is Reduce.
+		 * @return The resulting value.
+		 */
+		template<class Type> requires IsArithmeticType<Type>
+		[[nodiscard]] Type subgroupMax(const Type& value, GroupOperation operation = GroupOperation::Reduce) { return recordSubgroupArithmetic(SubgroupOperation::Max, value, operation); }
+
+		/**
+		 * Atomically add a value to the memory.
+		 * The target must be in a storage buffer, the workgroup memory (like a shared array element) or pointed by a device pointer.
+		 * The semantics are relaxed by default. If an ordering is given without a storage class, the storage class of the target is added.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The value to add.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicAdd(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Add, target, value, scope, semantics); }
+
+		/**
+		 * Atomically store the minimum of a value and the memory.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The value to compare.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicMin(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Min, target, value, scope, semantics); }
+
+		/**
+		 * Atomically store the maximum of a value and the memory.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The value to compare.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicMax(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Max, target, value, scope, semantics); }
+
+		/**
+		 * Atomically perform a bitwise and on the memory.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The bit mask.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicAnd(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::And, target, value, scope, semantics); }
+
+		/**
+		 * Atomically perform a bitwise or on the memory.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The bit mask.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicOr(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Or, target, value, scope, semantics); }
+
+		/**
+		 * Atomically perform a bitwise exclusive or on the memory.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The bit mask.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicXor(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Xor, target, value, scope, semantics); }
+
+		/**
+		 * Atomically replace the memory with a value.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The new value.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicExchange(Target&& target, const Value& value, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None) { return recordAtomicOperation(AtomicOperation::Exchange, target, value, scope, semantics); }
+
+		/**
+		 * Atomically replace the memory with a value if it's equal to the comparator.
+		 * The semantics are used when the values are equal. When they are not, the release semantics are dropped since nothing is written.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type. This is the target's scalar type or its value type.
+		 * @tparam Comparator The comparator type. This is the target's scalar type or its value type.
+		 * @param target The memory to update.
+		 * @param value The new value.
+		 * @param comparator The value to compare the memory with.
+		 * @param scope The scope of the invocations the operation is atomic with. Default is Device.
+		 * @param semantics The memory semantics. Default is None.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value, class Comparator>
+		typename AtomicTarget<std::remove_cvref_t<Target>>::Type atomicCompareExchange(Target&& target, const Value& value, const Comparator& comparator, Scope scope = Scope::Device, MemorySemantics semantics = MemorySemantics::None)
+		{
+			using Type = typename AtomicTarget<std::remove_cvref_t<Target>>::Type;
+			const auto valueIdentifier = getAtomicOperand<Type>(value);
+			const auto comparatorIdentifier = getAtomicOperand<Type>(comparator);
+
+			const auto [pointer, storageClass] = getAtomicPointer(target);
+			const auto equal = getAtomicSemantics(semantics, storageClass);
+			const auto unequal = getAtomicSemantics(GetUnequalSemantics(semantics), storageClass);
+
+			return recordAtomic<Type>("OpAtomicCompareExchange", fmt::format("{} {} {} {} {} {}", pointer, storeScope(scope), equal, unequal, valueIdentifier, comparatorIdentifier));
 		}
 
 		/**
 		 * Exit from the function by returning a value.
+		 * This can be used inside the control flow constructs for an early return. Anything recorded after it is unreachable.
 		 *
 		 * @tparam Type The value type.
 		 * @param value The value to return.
@@ -103,17 +691,52 @@ namespace ShaderBuilder
 		{
 			if (m_IsRecording)
 			{
-				// auto& block = m_Source.getCurrentFunctionBlock();
-				// block.m_Instructions.insert("OpReturn");
-				m_IsComplete = true;
+				m_Source.insertInstruction(fmt::format("OpReturnValue {}", value.getValueIdentifier()));
+
+				// The terminator ends the block, so anything recorded after it goes to a new (unreachable) block.
+				m_Source.insertInstruction(fmt::format("%{} = OpLabel", m_Source.getUniqueIdentifier()));
 			}
 		}
 
 		/**
 		 * Exit the function by returning nothing.
+		 * This can be used inside the control flow constructs for an early return. Anything recorded after it is unreachable.
 		 */
 		void exit();
 
+		/**
+		 * Finish recording the function by returning a value.
+		 * This is called by the function once its body is recorded, and ends the function block.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to return.
+		 */
+		template<class Type>
+		void finish(const Type& value)
+		{
+			if (m_IsRecording)
+			{
+				m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpReturnValue {}", value.getValueIdentifier()));
+				m_Source.finishFunctionBlock();
+				m_IsComplete = true;
+				m_IsRecording = false;
+			}
+		}
+
+		/**
+		 * Finish recording the function by returning nothing.
+		 * This is called by the function once its body is recorded, and ends the function block.
+		 */
+		void finish();
+
+		/**
+		 * Set the precision policy of the function.
+		 * This applies to the variables and results recorded from here on, except the ones of data types with their own policy.
+		 *
+		 * @param policy The precision policy.
+		 */
+		void setPrecisionPolicy(const PrecisionPolicy& policy) { m_Source.getCurrentFunctionBlock().m_PrecisionPolicy = policy; }
+
 		/**
 		 * Toggle the recording to false.
 		 * From here on, the builder will not record any instructions but will only create the variables.
@@ -128,6 +751,236 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] bool isRecording() const { return m_IsRecording; }
 
+	protected:
+		/**
+		 * Get a built-in variable.
+		 * The variable is declared and decorated the first time it is used, so only the used built-ins end up in the entry point's interface.
+		 *
+		 * @tparam Type The type of the built-in.
+		 * @param builtIn The built-in name.
+		 * @param storageClass The storage class of the built-in. Default is Input.
+		 * @return The built-in variable.
+		 */
+		template<class Type>
+		[[nodiscard]] Type getBuiltIn(const char* builtIn, const char* storageClass = "Input")
+		{
+			const auto identifier = fmt::format("gl_{}", builtIn);
+			if (m_Source.insertInterfaceVariable(identifier))
+			{
+				m_Source.insertType(fmt::format("%{} = OpVariable {} {}", identifier, m_Source.registerPointerType<Type>(storageClass), storageClass));
+				m_Source.insertAnnotation(fmt::format("OpDecorate %{} BuiltIn {}", identifier, builtIn));
+				m_Source.insertName(fmt::format("OpName %{} \"{}\"", identifier, identifier));
+			}
+
+			auto variable = Type(m_Source, identifier);
+			variable.setStorageClass(storageClass);
+
+			return variable;
+		}
+
+		/**
+		 * Store a scope constant.
+		 *
+		 * @param scope The scope.
+		 * @return The identifier of the constant.
+		 */
+		[[nodiscard]] std::string storeScope(Scope scope);
+
+		/**
+		 * Store a memory semantics constant.
+		 *
+		 * @param semantics The memory semantics.
+		 * @return The identifier of the constant.
+		 */
+		[[nodiscard]] std::string storeMemorySemantics(MemorySemantics semantics);
+
+		/**
+		 * Record a subgroup operation.
+		 * The required capabilities are inserted along with it.
+		 *
+		 * @tparam Result The result type.
+		 * @param capability The capability required by the operation.
+		 * @param instruction The instruction name.
+		 * @param operands The operands after the scope. Default is none.
+		 * @return The resulting temporary.
+		 */
+		template<class Result>
+		[[nodiscard]] Result recordSubgroupOperation(const char* capability, const char* instruction, const std::string& operands = "")
+		{
+			m_Source.insertCapability("OpCapability GroupNonUniform");
+			m_Source.insertCapability(fmt::format("OpCapability {}", capability));
+			m_Source.registerType<Result>();
+
+			const auto scope = storeScope(Scope::Subgroup);
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.insertInstruction(fmt::format("%{} = {} {} {}{}{}", identifier, instruction, TypeTraits<Result>::Identifier, scope, operands.empty() ? "" : " ", operands));
+
+			auto result = Result(m_Source, identifier);
+			result.markTemporary();
+
+			return result;
+		}
+
+		/**
+		 * Record a subgroup arithmetic operation.
+		 *
+		 * @tparam Type The value type.
+		 * @param operation The operation to perform.
+		 * @param value The value of the invocation.
+		 * @param groupOperation The group operation.
+		 * @return The resulting temporary.
+		 */
+		template<class Type>
+		[[nodiscard]] Type recordSubgroupArithmetic(SubgroupOperation operation, const Type& value, GroupOperation groupOperation)
+		{
+			using Value = typename TypeTraits<Type>::ValueTraits::Type;
+			return recordSubgroupOperation<Type>("GroupNonUniformArithmetic", GetSubgroupInstruction<Value>(operation), fmt::format("{} {}", GetGroupOperationString(groupOperation), value.getValueIdentifier()));
+		}
+
+		/**
+		 * Record an atomic operation which takes a single value.
+		 *
+		 * @tparam Target The target type.
+		 * @tparam Value The value type.
+		 * @param operation The operation to perform.
+		 * @param target The memory to update.
+		 * @param value The value of the operation.
+		 * @param scope The scope of the operation.
+		 * @param semantics The memory semantics.
+		 * @return The original value in memory.
+		 */
+		template<class Target, class Value>
+		[[nodiscard]] typename AtomicTarget<Target>::Type recordAtomicOperation(AtomicOperation operation, Target& target, const Value& value, Scope scope, MemorySemantics semantics)
+		{
+			using Type = typename AtomicTarget<Target>::Type;
+			const auto valueIdentifier = getAtomicOperand<Type>(value);
+
+			const auto [pointer, storageClass] = getAtomicPointer(target);
+			const auto instruction = GetAtomicInstruction<typename TypeTraits<Type>::ValueTraits::Type>(operation);
+
+			return recordAtomic<Type>(instruction, fmt::format("{} {} {} {}", pointer, storeScope(scope), getAtomicSemantics(semantics, storageClass), valueIdentifier));
+		}
+
+		/**
+		 * Record an atomic instruction.
+		 * Only 32 and 64 bit integers are supported, and 64 bit integers require the Int64Atomics capability which is inserted here.
+		 *
+		 * @tparam Type The value type.
+		 * @param instruction The instruction name.
+		 * @param operands The operands of the instruction.
+		 * @return The original value in memory.
+		 */
+		template<class Type>
+		[[nodiscard]] Type recordAtomic(const char* instruction, const std::string& operands)
+		{
+			using Value = typename TypeTraits<Type>::ValueTraits::Type;
+			static_assert(IsScalarType<Type> && std::is_integral_v<Value> && (sizeof(Value) == 4 || sizeof(Value) == 8), "Atomic operations are only supported on 32 and 64 bit integers!");
+
+			if constexpr (sizeof(Value) == 8)
+				m_Source.insertCapability("OpCapability Int64Atomics");
+
+			m_Source.registerType<Type>();
+
+			const auto identifier = m_Source.getUniqueIdentifier();
+			m_Source.insertInstruction(fmt::format("%{} = {} {} {}", identifier, instruction, TypeTraits<Type>::Identifier, operands));
+
+			auto result = Type(m_Source, identifier);
+			result.markTemporary();
+
+			return result;
+		}
+
+		/**
+		 * Get the identifier of an atomic operand.
+		 *
+		 * @tparam Type The value type of the operation.
+		 * @tparam Value The operand type. This is either a data type or a constant.
+		 * @param value The operand.
+		 * @return The value identifier.
+		 */
+		template<class Type, class Value>
+		[[nodiscard]] std::string getAtomicOperand(const Value& value)
+		{
+			if constexpr (std::is_arithmetic_v<Value>)
+			{
+				const auto constant = static_cast<typename TypeTraits<Type>::ValueTraits::Type>(value);
+				m_Source.storeConstant(constant);
+				return "%" + GetConstantIdentifier(constant);
+			}
+
+			else
+				return value.getValueIdentifier();
+		}
+
+		/**
+		 * Get the pointer to the memory of an atomic operation.
+		 *
+		 * @tparam Target The target type.
+		 * @param target The memory to update.
+		 * @return The pointer identifier and the storage class of the memory.
+		 */
+		template<class Target>
+		[[nodiscard]] std::pair<std::string, const char*> getAtomicPointer(Target& target)
+		{
+			if constexpr (IsDevicePointerType<Target>)
+				return { target.getValueIdentifier(), "PhysicalStorageBuffer" };
+
+			else
+				return { target.getPointerIdentifier(), target.getStorageClass() };
+		}
+
+		/**
+		 * Validate the storage class of an atomic operation and store its memory semantics.
+		 * The storage class semantics are added if an ordering is requested without any.
+		 *
+		 * @param semantics The memory semantics.
+		 * @param storageClass The storage class of the memory.
+		 * @return The identifier of the memory semantics constant.
+		 */
+		[[nodiscard]] std::string getAtomicSemantics(MemorySemantics semantics, const char* storageClass);
+
+		/**
+		 * Record a structured loop.
+		 * The header branches to a block which checks the condition, then to the body and the continue block, and back to the header.
+		 *
+		 * @tparam Condition The condition type.
+		 * @tparam Body The loop body type.
+		 * @tparam Continue The continue block type.
+		 * @param condition The function which records the condition and returns it as a Scalar<bool>.
+		 * @param body The function which records the loop body.
+		 * @param next The function which records the continue block, which runs after every iteration.
+		 * @param control The loop control flags.
+		 * @param maxIterations The maximum number of iterations, used with the MaxIterations flag.
+		 */
+		template<class Condition, class Body, class Continue>
+		void recordLoop(Condition&& condition, Body&& body, Continue&& next, LoopControl control, uint32_t maxIterations)
+		{
+			const auto headerLabel = m_Source.getUniqueIdentifier();
+			const auto conditionLabel = m_Source.getUniqueIdentifier();
+			const auto bodyLabel = m_Source.getUniqueIdentifier();
+			const auto continueLabel = m_Source.getUniqueIdentifier();
+			const auto mergeLabel = m_Source.getUniqueIdentifier();
+
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", headerLabel));
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", headerLabel));
+			m_Source.insertInstruction(fmt::format("OpLoopMerge %{} %{} {}", mergeLabel, continueLabel, GetLoopControlString(control, maxIterations)));
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", conditionLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", conditionLabel));
+			const Scalar<bool> result = condition();
+			m_Source.insertInstruction(fmt::format("OpBranchConditional {} %{} %{}", result.getValueIdentifier(), bodyLabel, mergeLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", bodyLabel));
+			body();
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", continueLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", continueLabel));
+			next();
+			m_Source.insertInstruction(fmt::format("OpBranch %{}", headerLabel));
+
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", mergeLabel));
+		}
+
 	protected:
 		SPIRVSource& m_Source;
 
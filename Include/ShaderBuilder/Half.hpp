@@ -0,0 +1,126 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <bit>
+#include <cstdint>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Convert a 32 bit floating point value to the bits of a 16 bit floating point value.
+	 * The value is rounded to the nearest even value.
+	 *
+	 * @param value The value to convert.
+	 * @return The half precision bits.
+	 */
+	[[nodiscard]] constexpr uint16_t FloatToHalfBits(float value)
+	{
+		const auto bits = std::bit_cast<uint32_t>(value);
+		const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+		const auto exponent = static_cast<int32_t>((bits >> 23) & 0xff) - 127 + 15;
+		auto mantissa = bits & 0x7fffff;
+
+		// Infinity and NaN.
+		if (((bits >> 23) & 0xff) == 0xff)
+			return sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0);
+
+		// Too large to be represented.
+		if (exponent >= 31)
+			return sign | 0x7c00;
+
+		// Too small to be a normal value, so it becomes a subnormal or zero.
+		if (exponent <= 0)
+		{
+			if (exponent < -10)
+				return sign;
+
+			mantissa |= 0x800000;
+			const auto shift = static_cast<uint32_t>(14 - exponent);
+			const auto remainder = mantissa & ((1u << shift) - 1);
+			const auto halfway = 1u << (shift - 1);
+
+			auto result = mantissa >> shift;
+			if (remainder > halfway || (remainder == halfway && (result & 1)))
+				result++;
+
+			return sign | static_cast<uint16_t>(result);
+		}
+
+		// Rounding up might carry into the exponent, which is still the correct result.
+		auto result = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+		const auto remainder = mantissa & 0x1fff;
+		if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1)))
+			result++;
+
+		return sign | static_cast<uint16_t>(result);
+	}
+
+	/**
+	 * Convert the bits of a 16 bit floating point value to a 32 bit floating point value.
+	 *
+	 * @param bits The half precision bits.
+	 * @return The converted value.
+	 */
+	[[nodiscard]] constexpr float HalfBitsToFloat(uint16_t bits)
+	{
+		const auto sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+		const auto exponent = static_cast<uint32_t>((bits >> 10) & 0x1f);
+		const auto mantissa = static_cast<uint32_t>(bits & 0x3ff);
+
+		// Infinity and NaN.
+		if (exponent == 0x1f)
+			return std::bit_cast<float>(sign | 0x7f800000 | (mantissa << 13));
+
+		// Zero and subnormals, which are the mantissa times 2^-24.
+		if (exponent == 0)
+		{
+			const auto value = static_cast<float>(mantissa) / 16777216.0f;
+			return sign ? -value : value;
+		}
+
+		return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+	}
+
+	/**
+	 * Half precision floating point structure.
+	 * This is only used to declare 16 bit floating point types and constants, so it does not support any arithmetic.
+	 * It is trivial so it can be used as a vector component.
+	 */
+	struct half final
+	{
+		/**
+		 * Default constructor.
+		 */
+		half() = default;
+
+		/**
+		 * Constructor.
+		 *
+		 * @param value The value to initialize with.
+		 */
+		constexpr half(float value) : m_Bits(FloatToHalfBits(value)) {}
+
+		/**
+		 * Float conversion operator.
+		 *
+		 * @return The value as a 32 bit floating point value.
+		 */
+		[[nodiscard]] constexpr operator float() const { return HalfBitsToFloat(m_Bits); }
+
+		uint16_t m_Bits;
+	};
+} // namespace ShaderBuilder
+
+/**
+ * Half formatter.
+ * Halves are formatted using their 32 bit value, which the assembler converts back to the same 16 bit value.
+ */
+template<>
+struct fmt::formatter<ShaderBuilder::half> : fmt::formatter<float>
+{
+	template<class FormatContext>
+	auto format(ShaderBuilder::half value, FormatContext& context) const { return fmt::formatter<float>::format(static_cast<float>(value), context); }
+};
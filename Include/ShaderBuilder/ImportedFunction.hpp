@@ -0,0 +1,49 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "DataType.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Imported function class.
+	 * This is a function declaration which is resolved when linking against a library which exports a function with the same name.
+	 *
+	 * @tparam Return The return type.
+	 * @tparam Parameters The parameter types.
+	 */
+	template<class Return, class... Parameters>
+	class ImportedFunction final : public DataType<ImportedFunction<Return, Parameters...>>
+	{
+	public:
+		using Super = DataType<ImportedFunction<Return, Parameters...>>;
+		using ReturnType = Return;
+
+		static constexpr uint32_t ParameterCount = sizeof...(Parameters);
+		static constexpr bool IsDeclaration = true;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to record all the instructions to.
+		 * @param linkageName The name of the function exported by the library.
+		 */
+		explicit ImportedFunction(SPIRVSource& source, const std::string& linkageName) : Super(source, source.getUniqueIdentifier())
+		{
+			Super::m_Source.template registerCallable<Return, Parameters...>();
+			Super::m_Source.insertCapability("OpCapability Linkage");
+			Super::m_Source.insertName(fmt::format("OpName %{} \"{}\"", Super::m_VariableName, linkageName));
+			Super::m_Source.insertAnnotation(fmt::format("OpDecorate %{} LinkageAttributes \"{}\" Import", Super::m_VariableName, linkageName));
+
+			// Declare the function without a body.
+			Super::m_Source.insertFunctionDeclaration(fmt::format("%{} = OpFunction {} None {}", Super::m_VariableName, TypeTraits<Return>::Identifier, Super::m_Source.template getFunctionIdentifier<Return, Parameters...>()));
+
+			auto declareParameter = [this](const char* identifier) { Super::m_Source.insertFunctionDeclaration(fmt::format("%{} = OpFunctionParameter {}", Super::m_Source.getUniqueIdentifier(), identifier)); };
+			(declareParameter(TypeTraits<Parameters>::Identifier), ...);
+
+			Super::m_Source.insertFunctionDeclaration("OpFunctionEnd");
+		}
+	};
+} // namespace ShaderBuilder
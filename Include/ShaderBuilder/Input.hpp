@@ -28,6 +28,7 @@ namespace ShaderBuilder
 			const auto identifier = Super::m_Data.getName();
 			Super::m_Source.insertType(fmt::format("%input_{} = OpTypePointer Input {}", identifier, TypeTraits<Type>::Identifier));
 			Super::m_Source.insertType(fmt::format("%{} = OpVariable %input_{} Input", identifier, identifier));
+			Super::m_Source.insertInputAttribute(InterfaceAttribute{ identifier, TypeTraits<Type>::Identifier, location });
 		}
 
 		/**
@@ -0,0 +1,231 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "TypeTraits.hpp"
+
+#include <string>
+#include <vector>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Layout rule enum.
+	 * This defines the rules used to compute the member offsets of a block.
+	 */
+	enum class LayoutRule : uint8_t
+	{
+		Std140,
+		Std430
+	};
+
+	/**
+	 * Align an offset to the required alignment.
+	 *
+	 * @param offset The offset to align.
+	 * @param alignment The alignment. This must be a power of two.
+	 * @return The aligned offset.
+	 */
+	[[nodiscard]] constexpr uint32_t AlignOffset(uint32_t offset, uint32_t alignment) { return (offset + alignment - 1) & ~(alignment - 1); }
+
+	/**
+	 * Type layout structure.
+	 * This computes the size and alignment of a type when it's placed inside a block.
+	 *
+	 * @tparam Type The type to compute the layout of.
+	 */
+	template<class Type>
+	struct TypeLayout final
+	{
+		using Traits = TypeTraits<Type>;
+
+		/**
+		 * Get the base alignment of the type.
+		 *
+		 * @param rule The layout rule.
+		 * @return The alignment in bytes.
+		 */
+		[[nodiscard]] static constexpr uint32_t alignment(LayoutRule rule)
+		{
+			if constexpr (IsMatrixType<Type>)
+				return matrixStride(rule);
+
+			else if constexpr (IsRuntimeArrayType<Type> || IsArrayType<Type>)
+			{
+				// Arrays are aligned to a vec4 when using std140.
+				const auto elementAlignment = TypeLayout<typename Traits::ValueTraits::Type>::alignment(rule);
+				return rule == LayoutRule::Std140 ? AlignOffset(elementAlignment, 16) : elementAlignment;
+			}
+
+			else if constexpr (IsCompexType<Type>)
+			{
+				// Three and four component vectors are aligned to four components.
+				constexpr uint32_t componentSize = Traits::ValueTraits::Size;
+				constexpr uint32_t componentCount = Traits::Size / componentSize;
+				return componentSize * (componentCount == 3 ? 4 : componentCount);
+			}
+
+			else
+				return Traits::Size;
+		}
+
+		/**
+		 * Get the size of the type.
+		 *
+		 * @param rule The layout rule.
+		 * @return The size in bytes.
+		 */
+		[[nodiscard]] static constexpr uint32_t size(LayoutRule rule)
+		{
+			if constexpr (IsMatrixType<Type>)
+				return matrixStride(rule) * Traits::ColumnCount;
+
+			// Every element takes up a whole stride, including the last one.
+			else if constexpr (IsArrayType<Type>)
+				return arrayStride(rule) * Traits::Length;
+
+			else
+				return Traits::Size;
+		}
+
+		/**
+		 * Get the stride between two elements of an array.
+		 *
+		 * @param rule The layout rule.
+		 * @return The stride in bytes. This is 0 if the type is not an array.
+		 */
+		[[nodiscard]] static constexpr uint32_t arrayStride(LayoutRule rule)
+		{
+			if constexpr (IsRuntimeArrayType<Type> || IsArrayType<Type>)
+				return AlignOffset(TypeLayout<typename Traits::ValueTraits::Type>::size(rule), alignment(rule));
+
+			else
+				return 0;
+		}
+
+		/**
+		 * Get the stride between two columns of a matrix.
+		 * Matrices are laid out as arrays of column vectors, which are rounded up to 16 bytes when using std140.
+		 *
+		 * @param rule The layout rule.
+		 * @return The stride in bytes. This is 0 if the type is not a matrix or an array of matrices.
+		 */
+		[[nodiscard]] static constexpr uint32_t matrixStride(LayoutRule rule)
+		{
+			if constexpr (IsMatrixType<Type>)
+			{
+				const auto columnAlignment = TypeLayout<typename Traits::ColumnTraits::Type>::alignment(rule);
+				return rule == LayoutRule::Std140 ? AlignOffset(columnAlignment, 16) : columnAlignment;
+			}
+
+			// Arrays of matrices use the stride of the element.
+			else if constexpr (IsRuntimeArrayType<Type> || IsArrayType<Type>)
+				return TypeLayout<typename Traits::ValueTraits::Type>::matrixStride(rule);
+
+			else
+				return 0;
+		}
+	};
+
+	/**
+	 * Member layout structure.
+	 * This contains the final placement of a single block member.
+	 */
+	struct MemberLayout final
+	{
+		std::string m_Name;
+		std::string m_TypeIdentifier;
+
+		uint32_t m_Index = 0;
+		uint32_t m_Offset = 0;
+		uint32_t m_Size = 0;
+		uint32_t m_Alignment = 0;
+		uint32_t m_MatrixStride = 0;
+		uint32_t m_ArrayStride = 0;
+
+		bool m_IsRuntimeArray = false;
+	};
+
+	/**
+	 * Block layout class.
+	 * This computes the member offsets of a block (uniform, storage buffer and so on). If requested, the members are reordered
+	 * so that the least amount of padding is used. The members can still be looked up using their names. A runtime array is
+	 * always kept as the last member.
+	 */
+	class BlockLayout final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		BlockLayout() = default;
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param members The members of the block in the order they are declared. The size, alignment and matrix stride should be set.
+		 * @param rule The layout rule used to compute the sizes and alignments.
+		 * @param optimize Whether to reorder the members to reduce the padding.
+		 */
+		explicit BlockLayout(std::vector<MemberLayout>&& members, LayoutRule rule, bool optimize);
+
+		/**
+		 * Get a member's layout using its name.
+		 *
+		 * @param name The name of the member.
+		 * @return The member layout.
+		 */
+		[[nodiscard]] const MemberLayout& getMember(const std::string& name) const;
+
+		/**
+		 * Get the members in the order they are declared.
+		 *
+		 * @return The member layouts.
+		 */
+		[[nodiscard]] const std::vector<MemberLayout>& getMembers() const { return m_Members; }
+
+		/**
+		 * Get the members in the order they are placed in the block.
+		 *
+		 * @return The member layouts.
+		 */
+		[[nodiscard]] std::vector<MemberLayout> getOrderedMembers() const;
+
+		/**
+		 * Get the size of the block if the members were placed in the declared order.
+		 *
+		 * @return The size in bytes.
+		 */
+		[[nodiscard]] uint32_t getPaddedSize() const { return m_PaddedSize; }
+
+		/**
+		 * Get the final size of the block.
+		 *
+		 * @return The size in bytes.
+		 */
+		[[nodiscard]] uint32_t getSize() const { return m_Size; }
+
+		/**
+		 * Get the layout rule.
+		 *
+		 * @return The rule.
+		 */
+		[[nodiscard]] LayoutRule getRule() const { return m_Rule; }
+
+		/**
+		 * Get a human readable report of the layout.
+		 * This contains the final offsets of the members and compares the padded size with the final size.
+		 *
+		 * @return The report string.
+		 */
+		[[nodiscard]] std::string getReport() const;
+
+	private:
+		std::vector<MemberLayout> m_Members;
+
+		uint32_t m_PaddedSize = 0;
+		uint32_t m_Size = 0;
+
+		LayoutRule m_Rule = LayoutRule::Std140;
+	};
+} // namespace ShaderBuilder
@@ -0,0 +1,62 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Builder.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Library builder class.
+	 * This builds a module without an entry point which exports its functions, so they can be compiled once and linked to other shaders.
+	 *
+	 * ```c++
+	 * ShaderBuilder::LibraryBuilder library;
+	 * auto helper = library.createFunction([](ShaderBuilder::FunctionBuilder& builder, ShaderBuilder::Parameter<ShaderBuilder::Vec3<float>> vec) {});
+	 * library.exportFunction(helper, "helper");
+	 * const auto binary = library.compile();
+	 *
+	 * ShaderBuilder::VertexBuilder shader;
+	 * auto imported = shader.importFunction<void, ShaderBuilder::Vec3<float>>("helper");
+	 * shader.linkLibrary(binary);
+	 * ```
+	 */
+	class LibraryBuilder final : public Builder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration. Make sure that this matches the configuration of the shaders it's linked to.
+		 */
+		explicit LibraryBuilder(Configuration config = Configuration()) : Builder(config) {}
+
+		/**
+		 * Create a new function.
+		 *
+		 * @tparam Lambda The lambda type.
+		 * @param function The function definition. Make sure that the function's first parameter/ argument is FunctionBuilder&.
+		 * @param control The function control flags. Default is None.
+		 * @return The function.
+		 */
+		template<class Lambda>
+		[[nodiscard]] decltype(auto) createFunction(Lambda&& function, FunctionControl control = FunctionControl::None) { return Function<std::decay_t<Lambda>>(m_Source, std::forward<Lambda>(function), control); }
+
+		/**
+		 * Export a function from the library.
+		 * This will record the function if it hasn't been recorded already.
+		 *
+		 * @tparam FunctionType The function type.
+		 * @param function The function to export.
+		 * @param linkageName The name which is used to import the function.
+		 */
+		template<class FunctionType>
+		void exportFunction(FunctionType& function, const std::string& linkageName)
+		{
+			function.record();
+
+			m_Source.insertCapability("OpCapability Linkage");
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} LinkageAttributes \"{}\" Export", function.getName(), linkageName));
+		}
+	};
+} // namespace ShaderBuilder
@@ -0,0 +1,117 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Vec3.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Matrix 3x3 data type.
+	 * The matrix is column major and contains 3 Vec3 columns.
+	 *
+	 * @tparam Type The value type. Default is float.
+	 */
+	template<class Type = float>
+	class Mat3 final : public DataType<Mat3<Type>>
+	{
+	public:
+		using Super = DataType<Mat3<Type>>;
+		using Traits = TypeTraits<Mat3<Type>>;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 */
+		explicit Mat3(SPIRVSource& source, const std::string& variableName) : Super(source, variableName) {}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param other The other to copy the data from.
+		 * @param shallow Whether we need a shallow copy or not. Default is false. If a shallow copy is performed, no instructions are recorded.
+		 */
+		explicit Mat3(SPIRVSource& source, const std::string& variableName, const Mat3& other, bool shallow = false) : Super(source, variableName)
+		{
+			// If we just need a shallow copy, return without storing any instructions.
+			if (shallow)
+				return;
+
+			Super::copyFrom(other);
+		}
+
+		/**
+		 * Explicit constructor.
+		 * This creates a diagonal matrix, so a value of 1 results in the identity matrix.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param value The value to set the diagonal to.
+		 */
+		explicit Mat3(SPIRVSource& source, const std::string& variableName, Type value) : Super(source, variableName)
+		{
+			source.template registerType<Mat3<Type>>();
+			source.storeConstant(value);
+			source.storeConstant(Type(0));
+
+			const auto diagonalIdentifier = GetConstantIdentifier(value);
+			const auto zeroIdentifier = GetConstantIdentifier(Type(0));
+			const auto identifier = fmt::format("{}_{}", Traits::RawIdentifier, diagonalIdentifier);
+
+			// Setup the column constants.
+			std::string columns;
+			for (uint32_t column = 0; column < Traits::ColumnCount; column++)
+			{
+				std::string components;
+				for (uint32_t row = 0; row < Traits::ColumnCount; row++)
+					components += fmt::format(" %{}", row == column ? diagonalIdentifier : zeroIdentifier);
+
+				source.insertType(fmt::format("%{}_column_{} = OpConstantComposite {}{}", identifier, column, Traits::ColumnTraits::Identifier, components));
+				columns += fmt::format(" %{}_column_{}", identifier, column);
+			}
+
+			// Setup the matrix constant.
+			source.insertType(fmt::format("%{} = OpConstantComposite {}{}", identifier, Traits::Identifier, columns));
+
+			// Initialization happens only within function definitions, so we can simply assign it there.
+			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %{}", variableName, identifier));
+		}
+
+		/**
+		 * Assignment operator.
+		 *
+		 * @param other The other matrix.
+		 * @return The altered matrix reference.
+		 */
+		Mat3& operator=(const Mat3& other)
+		{
+			Super::copyFrom(other);
+			return *this;
+		}
+	};
+
+	/**
+	 * Mat3 type traits.
+	 *
+	 * @tparam Type The value type.
+	 */
+	template<class Type>
+	struct TypeTraits<Mat3<Type>> : MatrixTraits<Mat3<Type>, Vec3<Type>, 3> {};
+
+	/**
+	 * Is complex type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsCompexType<Mat3<Type>> = true;
+
+	/**
+	 * Is matrix type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsMatrixType<Mat3<Type>> = true;
+} // namespace ShaderBuilder
@@ -0,0 +1,317 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "ComputeBuilder.hpp"
+#include "Vec4.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Mesh primitive enum.
+	 * This is the type of the primitives a mesh shader outputs.
+	 */
+	enum class MeshPrimitive : uint8_t
+	{
+		Points,
+		Lines,
+		Triangles
+	};
+
+	/**
+	 * Primitive index type.
+	 * Each primitive is made of one, two or three vertex indices depending on the primitive type.
+	 *
+	 * @tparam Primitive The primitive type.
+	 */
+	template<MeshPrimitive Primitive>
+	using PrimitiveIndexType = std::conditional_t<Primitive == MeshPrimitive::Points, Scalar<uint32_t>, std::conditional_t<Primitive == MeshPrimitive::Lines, Vec2<uint32_t>, Vec3<uint32_t>>>;
+
+	/**
+	 * Task function builder class.
+	 * This contains the task shader specific code that can be accessed by a task shader.
+	 */
+	class TaskFunctionBuilder final : public ComputeFunctionBuilder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The SPIRV source.
+		 */
+		explicit TaskFunctionBuilder(SPIRVSource& source) : ComputeFunctionBuilder(source) {}
+
+		/**
+		 * Launch the mesh shader workgroups.
+		 * This terminates the invocation, so it must be the last thing the task shader does. It must be called by all the invocations of the workgroup,
+		 * using the same values.
+		 *
+		 * @param x The number of workgroups in the x dimension.
+		 * @param y The number of workgroups in the y dimension.
+		 * @param z The number of workgroups in the z dimension.
+		 */
+		void emitMeshTasks(const Scalar<uint32_t>& x, const Scalar<uint32_t>& y, const Scalar<uint32_t>& z) { recordEmitMeshTasks(x, y, z, ""); }
+
+		/**
+		 * Launch the mesh shader workgroups and pass them the payload.
+		 * This terminates the invocation, so it must be the last thing the task shader does. It must be called by all the invocations of the workgroup,
+		 * using the same values.
+		 *
+		 * @tparam Type The payload type.
+		 * @param x The number of workgroups in the x dimension.
+		 * @param y The number of workgroups in the y dimension.
+		 * @param z The number of workgroups in the z dimension.
+		 * @param payload The payload created using TaskBuilder::createTaskPayload().
+		 */
+		template<class Type>
+		void emitMeshTasks(const Scalar<uint32_t>& x, const Scalar<uint32_t>& y, const Scalar<uint32_t>& z, const Type& payload) { recordEmitMeshTasks(x, y, z, " " + payload.getIdentifier()); }
+
+	private:
+		/**
+		 * Record the mesh task emission.
+		 *
+		 * @param x The number of workgroups in the x dimension.
+		 * @param y The number of workgroups in the y dimension.
+		 * @param z The number of workgroups in the z dimension.
+		 * @param payload The payload operand. This is empty if there is no payload.
+		 */
+		void recordEmitMeshTasks(const Scalar<uint32_t>& x, const Scalar<uint32_t>& y, const Scalar<uint32_t>& z, const std::string& payload);
+	};
+
+	/**
+	 * Mesh function builder class.
+	 * This contains the mesh shader specific code that can be accessed by a mesh shader.
+	 */
+	class MeshFunctionBuilder final : public ComputeFunctionBuilder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The SPIRV source.
+		 */
+		explicit MeshFunctionBuilder(SPIRVSource& source) : ComputeFunctionBuilder(source) {}
+
+		/**
+		 * Set the number of vertices and primitives the workgroup outputs.
+		 * This must be called once, by all the invocations of the workgroup, before writing any of the outputs. The counts must not be larger than the
+		 * maximums of the mesh builder.
+		 *
+		 * @param vertexCount The number of vertices.
+		 * @param primitiveCount The number of primitives.
+		 */
+		void setMeshOutputs(const Scalar<uint32_t>& vertexCount, const Scalar<uint32_t>& primitiveCount);
+	};
+
+	/**
+	 * Task builder class.
+	 * Task shaders run before the mesh shaders and decide how many mesh shader workgroups are launched, for example to cull meshlets.
+	 * This uses SPV_EXT_mesh_shader.
+	 */
+	class TaskBuilder final : public ComputeBuilder
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
+		 */
+		explicit TaskBuilder(Configuration config = Configuration());
+
+		/**
+		 * Create the payload which is passed to the mesh shader workgroups.
+		 * Only one payload can be used by an entry point, and it must be passed to TaskFunctionBuilder::emitMeshTasks().
+		 *
+		 * @tparam Type The payload type.
+		 * @return The created payload.
+		 */
+		template<class Type>
+		[[nodiscard]] Type createTaskPayload() { return createGlobalVariable<Type>("TaskPayloadWorkgroupEXT"); }
+	};
+
+	/**
+	 * Mesh builder class.
+	 * Mesh shaders output a small mesh per workgroup, which is rasterized without the input assembly and the vertex shader.
+	 * The outputs are arrays which are indexed by the vertex or the primitive index. This uses SPV_EXT_mesh_shader.
+	 *
+	 * For example,
+	 *
+	 * ```c++
+	 * auto builder = MeshBuilder<64, 126>();
+	 * auto positions = builder.createPositions();
+	 * auto indices = builder.createPrimitiveIndices();
+	 *
+	 * auto function = builder.createFunction([&](MeshFunctionBuilder& functionBuilder)
+	 *	{
+	 *		functionBuilder.setMeshOutputs(vertexCount, primitiveCount);
+	 *		positions[functionBuilder.getLocalInvocationIndex()] = position;
+	 *	});
+	 * ```
+	 *
+	 * @tparam MaxVertices The maximum number of vertices a workgroup can output.
+	 * @tparam MaxPrimitives The maximum number of primitives a workgroup can output.
+	 * @tparam Primitive The primitive type. Default is Triangles.
+	 */
+	template<uint32_t MaxVertices, uint32_t MaxPrimitives, MeshPrimitive Primitive = MeshPrimitive::Triangles>
+	class MeshBuilder final : public ComputeBuilder
+	{
+		static_assert(MaxVertices > 0 && MaxPrimitives > 0, "Mesh shaders must be able to output at least one vertex and one primitive!");
+
+	public:
+		using IndexType = PrimitiveIndexType<Primitive>;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
+		 */
+		explicit MeshBuilder(Configuration config = Configuration()) : ComputeBuilder(config, "MeshEXT")
+		{
+			m_Source.insertCapability("OpCapability MeshShadingEXT");
+			m_Source.insertExtension("OpExtension \"SPV_EXT_mesh_shader\"");
+		}
+
+		/**
+		 * Create the vertex positions.
+		 * This is the same as gl_MeshVerticesEXT[].gl_Position.
+		 *
+		 * @return The positions.
+		 */
+		[[nodiscard]] Array<Vec4<float>, MaxVertices> createPositions() { return createBuiltInOutput<Vec4<float>, MaxVertices>("Position", false); }
+
+		/**
+		 * Create the primitive indices.
+		 * Each element contains the indices of the vertices which make up the primitive.
+		 *
+		 * @return The indices.
+		 */
+		[[nodiscard]] Array<IndexType, MaxPrimitives> createPrimitiveIndices()
+		{
+			if constexpr (Primitive == MeshPrimitive::Points)
+				return createBuiltInOutput<IndexType, MaxPrimitives>("PrimitivePointIndicesEXT", false);
+
+			else if constexpr (Primitive == MeshPrimitive::Lines)
+				return createBuiltInOutput<IndexType, MaxPrimitives>("PrimitiveLineIndicesEXT", false);
+
+			else
+				return createBuiltInOutput<IndexType, MaxPrimitives>("PrimitiveTriangleIndicesEXT", false);
+		}
+
+		/**
+		 * Create the primitive culling flags.
+		 * Setting the flag of a primitive to true discards it, which is cheaper than outputting a degenerate primitive.
+		 *
+		 * @return The culling flags.
+		 */
+		[[nodiscard]] Array<Scalar<bool>, MaxPrimitives> createPrimitiveCulling() { return createBuiltInOutput<Scalar<bool>, MaxPrimitives>("CullPrimitiveEXT", true); }
+
+		/**
+		 * Create a new per-vertex output.
+		 * These are interpolated across the primitive, like the outputs of a vertex shader.
+		 *
+		 * @tparam Type The type of a vertex's output.
+		 * @param location The output location.
+		 * @return The output array.
+		 */
+		template<class Type>
+		[[nodiscard]] Array<Type, MaxVertices> createVertexOutput(uint32_t location) { return createOutputArray<Type, MaxVertices>(location, false); }
+
+		/**
+		 * Create a new per-primitive output.
+		 * These are the same for all the fragments of a primitive. The fragment shader must use FragmentBuilder::createPerPrimitiveInput() to read them.
+		 *
+		 * @tparam Type The type of a primitive's output.
+		 * @param location The output location.
+		 * @return The output array.
+		 */
+		template<class Type>
+		[[nodiscard]] Array<Type, MaxPrimitives> createPrimitiveOutput(uint32_t location) { return createOutputArray<Type, MaxPrimitives>(location, true); }
+
+		/**
+		 * Create the payload which is passed from the task shader.
+		 * The type must be the same as the one used by TaskBuilder::createTaskPayload().
+		 *
+		 * @tparam Type The payload type.
+		 * @return The created payload.
+		 */
+		template<class Type>
+		[[nodiscard]] Type createTaskPayload() { return createGlobalVariable<Type>("TaskPayloadWorkgroupEXT"); }
+
+	private:
+		/**
+		 * Create a built-in output array.
+		 *
+		 * @tparam Type The element type.
+		 * @tparam Length The number of elements.
+		 * @param builtIn The built-in name.
+		 * @param isPerPrimitive Whether the built-in is per-primitive.
+		 * @return The output array.
+		 */
+		template<class Type, uint32_t Length>
+		[[nodiscard]] Array<Type, Length> createBuiltInOutput(const char* builtIn, bool isPerPrimitive)
+		{
+			const auto identifier = fmt::format("gl_{}", builtIn);
+			if (m_Source.insertInterfaceVariable(identifier))
+			{
+				m_Source.insertType(fmt::format("%{} = OpVariable {} Output", identifier, m_Source.registerPointerType<Array<Type, Length>>("Output")));
+				m_Source.insertAnnotation(fmt::format("OpDecorate %{} BuiltIn {}", identifier, builtIn));
+				m_Source.insertName(fmt::format("OpName %{} \"{}\"", identifier, identifier));
+
+				if (isPerPrimitive)
+					m_Source.insertAnnotation(fmt::format("OpDecorate %{} PerPrimitiveEXT", identifier));
+			}
+
+			auto output = Array<Type, Length>(m_Source, identifier);
+			output.setStorageClass("Output");
+
+			return output;
+		}
+
+		/**
+		 * Create an output array.
+		 *
+		 * @tparam Type The element type.
+		 * @tparam Length The number of elements.
+		 * @param location The output location.
+		 * @param isPerPrimitive Whether the output is per-primitive.
+		 * @return The output array.
+		 */
+		template<class Type, uint32_t Length>
+		[[nodiscard]] Array<Type, Length> createOutputArray(uint32_t location, bool isPerPrimitive)
+		{
+			auto output = createGlobalVariable<Array<Type, Length>>("Output");
+			m_Source.insertAnnotation(fmt::format("OpDecorate {} Location {}", output.getIdentifier(), location));
+
+			// The next stage reads a single element, so that's the type it's matched with.
+			m_Source.insertOutputAttribute(InterfaceAttribute{ output.getName(), TypeTraits<Type>::Identifier, location });
+
+			if (isPerPrimitive)
+				m_Source.insertAnnotation(fmt::format("OpDecorate {} PerPrimitiveEXT", output.getIdentifier()));
+
+			return output;
+		}
+
+		/**
+		 * Insert the execution modes of an entry point.
+		 *
+		 * @param name The name of the entry point function.
+		 */
+		void insertExecutionModes(const std::string& name) override
+		{
+			ComputeBuilder::insertExecutionModes(name);
+
+			m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OutputVertices {}", name, MaxVertices));
+			m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OutputPrimitivesEXT {}", name, MaxPrimitives));
+
+			if constexpr (Primitive == MeshPrimitive::Points)
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OutputPoints", name));
+
+			else if constexpr (Primitive == MeshPrimitive::Lines)
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OutputLinesEXT", name));
+
+			else
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OutputTrianglesEXT", name));
+		}
+	};
+} // namespace ShaderBuilder
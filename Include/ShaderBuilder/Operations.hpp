@@ -0,0 +1,668 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Scalar.hpp"
+
+#include <type_traits>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Arithmetic operation enum.
+	 */
+	enum class ArithmeticOperation : uint8_t
+	{
+		Add,
+		Subtract,
+		Multiply,
+		Divide
+	};
+
+	/**
+	 * Comparison operation enum.
+	 */
+	enum class ComparisonOperation : uint8_t
+	{
+		Equal,
+		NotEqual,
+		LessThan,
+		LessThanEqual,
+		GreaterThan,
+		GreaterThanEqual
+	};
+
+	/**
+	 * Is arithmetic type boolean.
+	 * Arithmetic operators are available for these types and all of them operate on the whole value at once.
+	 */
+	template<class Type>
+	constexpr bool IsArithmeticType = (IsVectorType<Type> || IsScalarType<Type>) && !std::is_same_v<Type, Scalar<bool>>;
+
+	/**
+	 * Vector of structure.
+	 * This resolves the vector type which holds a given number of components. Each vector header specializes it.
+	 *
+	 * @tparam Value The component value type.
+	 * @tparam Count The number of components.
+	 */
+	template<class Value, uint8_t Count>
+	struct VectorOf;
+
+	/**
+	 * Vector of specialization for a single component.
+	 *
+	 * @tparam Value The component value type.
+	 */
+	template<class Value>
+	struct VectorOf<Value, 1> { using Type = Scalar<Value>; };
+
+	/**
+	 * Get the index of a swizzle component.
+	 * The xyzw, rgba and stpq component sets are supported.
+	 *
+	 * @param component The component character.
+	 * @return The component index. This is 4 if the character is not a component.
+	 */
+	[[nodiscard]] constexpr uint32_t GetComponentIndex(char component)
+	{
+		switch (component)
+		{
+		case 'x': case 'r': case 's':										return 0;
+		case 'y': case 'g': case 't':										return 1;
+		case 'z': case 'b': case 'p':										return 2;
+		case 'w': case 'a': case 'q':										return 3;
+		default:															return 4;
+		}
+	}
+
+	/**
+	 * Get the arithmetic instruction for a value type.
+	 *
+	 * @tparam Value The value type of the operands.
+	 * @param operation The operation to perform.
+	 * @return The instruction name.
+	 */
+	template<class Value>
+	[[nodiscard]] constexpr const char* GetArithmeticInstruction(ArithmeticOperation operation)
+	{
+		if constexpr (IsFloatingPoint<Value>)
+		{
+			switch (operation)
+			{
+			case ArithmeticOperation::Add:										return "OpFAdd";
+			case ArithmeticOperation::Subtract:									return "OpFSub";
+			case ArithmeticOperation::Multiply:									return "OpFMul";
+			default:															return "OpFDiv";
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+			case ArithmeticOperation::Add:										return "OpIAdd";
+			case ArithmeticOperation::Subtract:									return "OpISub";
+			case ArithmeticOperation::Multiply:									return "OpIMul";
+			default:															return std::is_signed_v<Value> ? "OpSDiv" : "OpUDiv";
+			}
+		}
+	}
+
+	/**
+	 * Get the comparison instruction for a value type.
+	 *
+	 * @tparam Value The value type of the operands.
+	 * @param operation The operation to perform.
+	 * @return The instruction name.
+	 */
+	template<class Value>
+	[[nodiscard]] constexpr const char* GetComparisonInstruction(ComparisonOperation operation)
+	{
+		if constexpr (IsFloatingPoint<Value>)
+		{
+			switch (operation)
+			{
+			case ComparisonOperation::Equal:									return "OpFOrdEqual";
+			case ComparisonOperation::NotEqual:									return "OpFOrdNotEqual";
+			case ComparisonOperation::LessThan:									return "OpFOrdLessThan";
+			case ComparisonOperation::LessThanEqual:							return "OpFOrdLessThanEqual";
+			case ComparisonOperation::GreaterThan:								return "OpFOrdGreaterThan";
+			default:															return "OpFOrdGreaterThanEqual";
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+			case ComparisonOperation::Equal:									return "OpIEqual";
+			case ComparisonOperation::NotEqual:									return "OpINotEqual";
+			case ComparisonOperation::LessThan:									return std::is_signed_v<Value> ? "OpSLessThan" : "OpULessThan";
+			case ComparisonOperation::LessThanEqual:							return std::is_signed_v<Value> ? "OpSLessThanEqual" : "OpULessThanEqual";
+			case ComparisonOperation::GreaterThan:								return std::is_signed_v<Value> ? "OpSGreaterThan" : "OpUGreaterThan";
+			default:															return std::is_signed_v<Value> ? "OpSGreaterThanEqual" : "OpUGreaterThanEqual";
+			}
+		}
+	}
+
+	/**
+	 * Record a comparison between a scalar and another value.
+	 *
+	 * @tparam Value The value type of the operands.
+	 * @param operation The operation to perform.
+	 * @param lhs The left hand side operand.
+	 * @param rhsIdentifier The identifier of the right hand side value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> RecordComparison(ComparisonOperation operation, const Scalar<Value>& lhs, const std::string& rhsIdentifier)
+	{
+		static_assert(!std::is_same_v<Value, bool>, "Booleans can only be compared using logical operations!");
+		return lhs.template recordOperation<Scalar<bool>>(GetComparisonInstruction<Value>(operation), fmt::format("{} {}", lhs.getValueIdentifier(), rhsIdentifier));
+	}
+
+	/**
+	 * Record an arithmetic operation between two values of the same type.
+	 *
+	 * @tparam Type The operand type.
+	 * @param operation The operation to perform.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type>
+	[[nodiscard]] Type RecordArithmetic(ArithmeticOperation operation, const Type& lhs, const Type& rhs)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+		return lhs.template recordOperation<Type>(GetArithmeticInstruction<Value>(operation), fmt::format("{} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier()));
+	}
+
+	/**
+	 * Record a vector and scalar operation.
+	 * Floating point vectors are multiplied using a single OpVectorTimesScalar. Otherwise the scalar is splat to a vector first.
+	 *
+	 * @tparam Type The vector type.
+	 * @param operation The operation to perform.
+	 * @param vector The vector.
+	 * @param scalarIdentifier The identifier of the scalar value.
+	 * @return The resulting temporary.
+	 */
+	template<class Type>
+	[[nodiscard]] Type RecordScale(ArithmeticOperation operation, const Type& vector, const std::string& scalarIdentifier)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+
+		// Scalars do not need any special handling.
+		if constexpr (IsScalarType<Type>)
+			return vector.template recordOperation<Type>(GetArithmeticInstruction<Value>(operation), fmt::format("{} {}", vector.getValueIdentifier(), scalarIdentifier));
+
+		else
+		{
+			const auto vectorIdentifier = vector.getValueIdentifier();
+			if constexpr (IsFloatingPoint<Value>)
+			{
+				if (operation == ArithmeticOperation::Multiply)
+					return vector.template recordOperation<Type>("OpVectorTimesScalar", fmt::format("{} {}", vectorIdentifier, scalarIdentifier));
+			}
+
+			auto components = scalarIdentifier;
+			for (uint8_t i = 1; i < TypeTraits<Type>::Size / TypeTraits<Type>::ValueTraits::Size; i++)
+				components += fmt::format(" {}", scalarIdentifier);
+
+			const auto splat = vector.template recordOperation<Type>("OpCompositeConstruct", components);
+			return vector.template recordOperation<Type>(GetArithmeticInstruction<Value>(operation), fmt::format("{} {}", vectorIdentifier, splat.getIdentifier()));
+		}
+	}
+
+	/**
+	 * Addition operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator+(const Type& lhs, const Type& rhs) { return RecordArithmetic(ArithmeticOperation::Add, lhs, rhs); }
+
+	/**
+	 * Subtraction operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator-(const Type& lhs, const Type& rhs) { return RecordArithmetic(ArithmeticOperation::Subtract, lhs, rhs); }
+
+	/**
+	 * Multiplication operator.
+	 * Vectors are multiplied component wise.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator*(const Type& lhs, const Type& rhs) { return RecordArithmetic(ArithmeticOperation::Multiply, lhs, rhs); }
+
+	/**
+	 * Division operator.
+	 * Vectors are divided component wise.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator/(const Type& lhs, const Type& rhs) { return RecordArithmetic(ArithmeticOperation::Divide, lhs, rhs); }
+
+	/**
+	 * Negation operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param value The value to negate.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator-(const Type& value)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+		static_assert(std::is_signed_v<Value>, "Unsigned values cannot be negated!");
+
+		return value.template recordOperation<Type>(IsFloatingPoint<Value> ? "OpFNegate" : "OpSNegate", value.getValueIdentifier());
+	}
+
+	/**
+	 * Vector and scalar multiplication operator.
+	 *
+	 * @tparam Type The vector type.
+	 * @param lhs The vector.
+	 * @param rhs The scalar.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Type operator*(const Type& lhs, const Scalar<typename TypeTraits<Type>::ValueTraits::Type>& rhs) { return RecordScale(ArithmeticOperation::Multiply, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Scalar and vector multiplication operator.
+	 *
+	 * @tparam Type The vector type.
+	 * @param lhs The scalar.
+	 * @param rhs The vector.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Type operator*(const Scalar<typename TypeTraits<Type>::ValueTraits::Type>& lhs, const Type& rhs) { return RecordScale(ArithmeticOperation::Multiply, rhs, lhs.getValueIdentifier()); }
+
+	/**
+	 * Vector and scalar division operator.
+	 *
+	 * @tparam Type The vector type.
+	 * @param lhs The vector.
+	 * @param rhs The scalar.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Type operator/(const Type& lhs, const Scalar<typename TypeTraits<Type>::ValueTraits::Type>& rhs) { return RecordScale(ArithmeticOperation::Divide, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant addition operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The operand.
+	 * @param rhs The constant value.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator+(const Type& lhs, typename TypeTraits<Type>::ValueTraits::Type rhs) { return RecordScale(ArithmeticOperation::Add, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Constant subtraction operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The operand.
+	 * @param rhs The constant value.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator-(const Type& lhs, typename TypeTraits<Type>::ValueTraits::Type rhs) { return RecordScale(ArithmeticOperation::Subtract, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Constant multiplication operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The operand.
+	 * @param rhs The constant value.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator*(const Type& lhs, typename TypeTraits<Type>::ValueTraits::Type rhs) { return RecordScale(ArithmeticOperation::Multiply, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Constant multiplication operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The constant value.
+	 * @param rhs The operand.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator*(typename TypeTraits<Type>::ValueTraits::Type lhs, const Type& rhs) { return RecordScale(ArithmeticOperation::Multiply, rhs, rhs.storeConstant(lhs)); }
+
+	/**
+	 * Constant division operator.
+	 *
+	 * @tparam Type The operand type.
+	 * @param lhs The operand.
+	 * @param rhs The constant value.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] Type operator/(const Type& lhs, typename TypeTraits<Type>::ValueTraits::Type rhs) { return RecordScale(ArithmeticOperation::Divide, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Equality operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator==(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::Equal, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant equality operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator==(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::Equal, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Inequality operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator!=(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::NotEqual, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant inequality operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator!=(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::NotEqual, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Less than operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator<(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::LessThan, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant less than operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator<(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::LessThan, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Less than or equal operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator<=(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::LessThanEqual, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant less than or equal operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator<=(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::LessThanEqual, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Greater than operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator>(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::GreaterThan, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant greater than operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator>(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::GreaterThan, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Greater than or equal operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator>=(const Scalar<Value>& lhs, const Scalar<Value>& rhs) { return RecordComparison(ComparisonOperation::GreaterThanEqual, lhs, rhs.getValueIdentifier()); }
+
+	/**
+	 * Constant greater than or equal operator.
+	 *
+	 * @tparam Value The value type.
+	 * @param lhs The left hand side operand.
+	 * @param rhs The constant value.
+	 * @return The resulting boolean temporary.
+	 */
+	template<class Value>
+	[[nodiscard]] Scalar<bool> operator>=(const Scalar<Value>& lhs, std::type_identity_t<Value> rhs) { return RecordComparison(ComparisonOperation::GreaterThanEqual, lhs, lhs.storeConstant(rhs)); }
+
+	/**
+	 * Logical and operator.
+	 * Note that both of the operands are always evaluated.
+	 *
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	[[nodiscard]] inline Scalar<bool> operator&&(const Scalar<bool>& lhs, const Scalar<bool>& rhs) { return lhs.recordOperation<Scalar<bool>>("OpLogicalAnd", fmt::format("{} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier())); }
+
+	/**
+	 * Logical or operator.
+	 * Note that both of the operands are always evaluated.
+	 *
+	 * @param lhs The left hand side operand.
+	 * @param rhs The right hand side operand.
+	 * @return The resulting boolean temporary.
+	 */
+	[[nodiscard]] inline Scalar<bool> operator||(const Scalar<bool>& lhs, const Scalar<bool>& rhs) { return lhs.recordOperation<Scalar<bool>>("OpLogicalOr", fmt::format("{} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier())); }
+
+	/**
+	 * Logical not operator.
+	 *
+	 * @param value The value to negate.
+	 * @return The resulting boolean temporary.
+	 */
+	[[nodiscard]] inline Scalar<bool> operator!(const Scalar<bool>& value) { return value.recordOperation<Scalar<bool>>("OpLogicalNot", value.getValueIdentifier()); }
+
+	/**
+	 * Compute the dot product of two vectors.
+	 *
+	 * @tparam Type The vector type.
+	 * @param lhs The first vector.
+	 * @param rhs The second vector.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Scalar<typename TypeTraits<Type>::ValueTraits::Type> Dot(const Type& lhs, const Type& rhs)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+		static_assert(IsFloatingPoint<Value>, "The dot product is only available for floating point vectors!");
+
+		return lhs.template recordOperation<Scalar<Value>>("OpDot", fmt::format("{} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier()));
+	}
+
+	/**
+	 * Compute the cross product of two three component vectors.
+	 *
+	 * @tparam Type The vector type.
+	 * @param lhs The first vector.
+	 * @param rhs The second vector.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Type Cross(const Type& lhs, const Type& rhs)
+	{
+		static_assert(IsFloatingPoint<typename TypeTraits<Type>::ValueTraits::Type>, "The cross product is only available for floating point vectors!");
+		static_assert(TypeTraits<Type>::Size / TypeTraits<Type>::ValueTraits::Size == 3, "The cross product is only available for three component vectors!");
+		return lhs.template recordOperation<Type>("OpExtInst", fmt::format("%glsl Cross {} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier()));
+	}
+
+	/**
+	 * Compute the length of a vector.
+	 *
+	 * @tparam Type The vector type.
+	 * @param vector The vector.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Scalar<typename TypeTraits<Type>::ValueTraits::Type> Length(const Type& vector)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+		static_assert(IsFloatingPoint<Value>, "The length is only available for floating point vectors!");
+
+		return vector.template recordOperation<Scalar<Value>>("OpExtInst", fmt::format("%glsl Length {}", vector.getValueIdentifier()));
+	}
+
+	/**
+	 * Normalize a vector.
+	 *
+	 * @tparam Type The vector type.
+	 * @param vector The vector.
+	 * @return The resulting temporary.
+	 */
+	template<class Type> requires IsVectorType<Type>
+	[[nodiscard]] Type Normalize(const Type& vector)
+	{
+		static_assert(IsFloatingPoint<typename TypeTraits<Type>::ValueTraits::Type>, "Only floating point vectors can be normalized!");
+		return vector.template recordOperation<Type>("OpExtInst", fmt::format("%glsl Normalize {}", vector.getValueIdentifier()));
+	}
+
+	/**
+	 * Get the conversion instruction between two value types.
+	 *
+	 * @tparam From The value type to convert from.
+	 * @tparam To The value type to convert to.
+	 * @return The instruction name.
+	 */
+	template<class From, class To>
+	[[nodiscard]] constexpr const char* GetConversionInstruction()
+	{
+		if constexpr (IsFloatingPoint<From> && IsFloatingPoint<To>)
+			return "OpFConvert";
+
+		else if constexpr (IsFloatingPoint<From>)
+			return std::is_signed_v<To> ? "OpConvertFToS" : "OpConvertFToU";
+
+		else if constexpr (IsFloatingPoint<To>)
+			return std::is_signed_v<From> ? "OpConvertSToF" : "OpConvertUToF";
+
+		else if constexpr (sizeof(From) == sizeof(To))
+			return "OpBitcast";
+
+		else
+			return std::is_signed_v<From> ? "OpSConvert" : "OpUConvert";
+	}
+
+	/**
+	 * Convert a scalar or a vector to another value type.
+	 * This is mostly used to widen values which are stored using a smaller type, like half precision inputs.
+	 *
+	 * @tparam Value The value type to convert to.
+	 * @tparam Type The scalar or vector type.
+	 * @param value The value to convert.
+	 * @return The resulting temporary.
+	 */
+	template<class Value, class Type> requires IsArithmeticType<Type>
+	[[nodiscard]] auto Convert(const Type& value)
+	{
+		using From = typename TypeTraits<Type>::ValueTraits::Type;
+		using Result = typename VectorOf<Value, TypeTraits<Type>::Size / TypeTraits<Type>::ValueTraits::Size>::Type;
+
+		// Unsigned integers have to be zero extended using an unsigned result, and then reinterpreted.
+		if constexpr (std::is_integral_v<From> && std::is_unsigned_v<From> && std::is_integral_v<Value> && std::is_signed_v<Value> && sizeof(From) != sizeof(Value))
+			return Convert<Value>(Convert<std::make_unsigned_t<Value>>(value));
+
+		else
+			return value.template recordOperation<Result>(GetConversionInstruction<From, Value>(), value.getValueIdentifier());
+	}
+
+	/**
+	 * Swizzle a vector.
+	 * A single component is extracted, and multiple components are selected using a single OpVectorShuffle.
+	 *
+	 * @tparam Components The components to select.
+	 * @tparam Type The vector type.
+	 * @param vector The vector to swizzle.
+	 * @return The resulting temporary.
+	 */
+	template<char... Components, class Type> requires IsVectorType<Type>
+	[[nodiscard]] auto Swizzle(const Type& vector)
+	{
+		using Value = typename TypeTraits<Type>::ValueTraits::Type;
+		using Result = typename VectorOf<Value, sizeof...(Components)>::Type;
+
+		static_assert(sizeof...(Components) > 0 && sizeof...(Components) <= 4, "A swizzle can only select one to four components!");
+		static_assert(((GetComponentIndex(Components) < TypeTraits<Type>::Size / TypeTraits<Type>::ValueTraits::Size) && ...), "Invalid swizzle component!");
+
+		const auto identifier = vector.getValueIdentifier();
+		if constexpr (sizeof...(Components) == 1)
+			return vector.template recordOperation<Result>("OpCompositeExtract", fmt::format("{} {}", identifier, GetComponentIndex(Components)...));
+
+		else
+		{
+			auto operands = fmt::format("{} {}", identifier, identifier);
+			((operands += fmt::format(" {}", GetComponentIndex(Components))), ...);
+
+			return vector.template recordOperation<Result>("OpVectorShuffle", operands);
+		}
+	}
+} // namespace ShaderBuilder
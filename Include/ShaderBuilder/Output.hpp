@@ -29,6 +29,7 @@ namespace ShaderBuilder
 			const auto identifier = Super::m_Data.getName();
 			Super::m_Source.insertType(fmt::format("%output_{} = OpTypePointer Output {}", identifier, TypeTraits<Type>::Identifier));
 			Super::m_Source.insertType(fmt::format("%{} = OpVariable %output_{} Output", identifier, identifier));
+			Super::m_Source.insertOutputAttribute(InterfaceAttribute{ identifier, TypeTraits<Type>::Identifier, location });
 		}
 
 		/**
@@ -0,0 +1,121 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Vec4.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Unpack two half precision floats from a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed value. The first component is stored in the lower 16 bits.
+	 * @return The unpacked vector.
+	 */
+	[[nodiscard]] inline Vec2<float> UnpackHalf2x16(const Scalar<uint32_t>& packed)
+	{
+		return packed.recordOperation<Vec2<float>>("OpExtInst", fmt::format("%glsl UnpackHalf2x16 {}", packed.getValueIdentifier()));
+	}
+
+	/**
+	 * Unpack two 16 bit unsigned normalized values from a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed value. The first component is stored in the lower 16 bits.
+	 * @return The unpacked vector, with components in the [0, 1] range.
+	 */
+	[[nodiscard]] inline Vec2<float> UnpackUnorm2x16(const Scalar<uint32_t>& packed)
+	{
+		return packed.recordOperation<Vec2<float>>("OpExtInst", fmt::format("%glsl UnpackUnorm2x16 {}", packed.getValueIdentifier()));
+	}
+
+	/**
+	 * Unpack two 16 bit signed normalized values from a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed value. The first component is stored in the lower 16 bits.
+	 * @return The unpacked vector, with components in the [-1, 1] range.
+	 */
+	[[nodiscard]] inline Vec2<float> UnpackSnorm2x16(const Scalar<uint32_t>& packed)
+	{
+		return packed.recordOperation<Vec2<float>>("OpExtInst", fmt::format("%glsl UnpackSnorm2x16 {}", packed.getValueIdentifier()));
+	}
+
+	/**
+	 * Unpack four 8 bit unsigned normalized values from a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed value. The first component is stored in the lowest 8 bits.
+	 * @return The unpacked vector, with components in the [0, 1] range.
+	 */
+	[[nodiscard]] inline Vec4<float> UnpackUnorm4x8(const Scalar<uint32_t>& packed)
+	{
+		return packed.recordOperation<Vec4<float>>("OpExtInst", fmt::format("%glsl UnpackUnorm4x8 {}", packed.getValueIdentifier()));
+	}
+
+	/**
+	 * Unpack four 8 bit signed normalized values from a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed value. The first component is stored in the lowest 8 bits.
+	 * @return The unpacked vector, with components in the [-1, 1] range.
+	 */
+	[[nodiscard]] inline Vec4<float> UnpackSnorm4x8(const Scalar<uint32_t>& packed)
+	{
+		return packed.recordOperation<Vec4<float>>("OpExtInst", fmt::format("%glsl UnpackSnorm4x8 {}", packed.getValueIdentifier()));
+	}
+
+	/**
+	 * Decode a position stored as four 16 bit normalized values in two 32 bit unsigned integers (like R16G16B16A16_UNORM read as R32G32_UINT).
+	 * The fourth value is ignored. The decoded position is in the [0, 1] range (or [-1, 1] if signed), so it usually has to be scaled by the mesh bounds.
+	 *
+	 * @param packed The packed position.
+	 * @param isSigned Whether the values are signed normalized. Default is false.
+	 * @return The decoded position.
+	 */
+	[[nodiscard]] inline Vec3<float> DecodeNormalizedPosition(const Vec2<uint32_t>& packed, bool isSigned = false)
+	{
+		// Load the packed value only once.
+		const auto value = packed.getValueIdentifier();
+		const auto low = packed.recordOperation<Scalar<uint32_t>>("OpCompositeExtract", fmt::format("{} 0", value));
+		const auto high = packed.recordOperation<Scalar<uint32_t>>("OpCompositeExtract", fmt::format("{} 1", value));
+
+		const auto xy = isSigned ? UnpackSnorm2x16(low) : UnpackUnorm2x16(low);
+		const auto zw = isSigned ? UnpackSnorm2x16(high) : UnpackUnorm2x16(high);
+		const auto z = zw.swizzle<'x'>();
+
+		return xy.recordOperation<Vec3<float>>("OpCompositeConstruct", fmt::format("{} {}", xy.getIdentifier(), z.getIdentifier()));
+	}
+
+	/**
+	 * Decode a unit normal stored using the octahedral encoding, as two 16 bit signed normalized values in a 32 bit unsigned integer.
+	 *
+	 * @param packed The packed normal.
+	 * @return The decoded and normalized normal.
+	 */
+	[[nodiscard]] inline Vec3<float> DecodeOctahedralNormal(const Scalar<uint32_t>& packed)
+	{
+		const auto encoded = UnpackSnorm2x16(packed);
+		const auto x = encoded.swizzle<'x'>();
+		const auto y = encoded.swizzle<'y'>();
+
+		// z = 1 - |x| - |y|
+		const auto absoluteX = x.recordOperation<Scalar<float>>("OpExtInst", fmt::format("%glsl FAbs {}", x.getIdentifier()));
+		const auto absoluteY = y.recordOperation<Scalar<float>>("OpExtInst", fmt::format("%glsl FAbs {}", y.getIdentifier()));
+		const auto z = -(absoluteX + absoluteY) + 1.0f;
+
+		// The lower hemisphere is folded over the diagonals, so unfold it using t = max(-z, 0).
+		const auto negatedZ = -z;
+		const auto t = z.recordOperation<Scalar<float>>("OpExtInst", fmt::format("%glsl FMax {} {}", negatedZ.getIdentifier(), z.storeConstant(0.0f)));
+		const auto negatedT = -t;
+
+		auto unfold = [&t, &negatedT](const Scalar<float>& component)
+		{
+			const auto isPositive = component >= 0.0f;
+			const auto offset = component.recordOperation<Scalar<float>>("OpSelect", fmt::format("{} {} {}", isPositive.getIdentifier(), negatedT.getIdentifier(), t.getIdentifier()));
+			return component + offset;
+		};
+
+		const auto unfoldedX = unfold(x);
+		const auto unfoldedY = unfold(y);
+		const auto normal = x.recordOperation<Vec3<float>>("OpCompositeConstruct", fmt::format("{} {} {}", unfoldedX.getIdentifier(), unfoldedY.getIdentifier(), z.getIdentifier()));
+
+		return Normalize(normal);
+	}
+} // namespace ShaderBuilder
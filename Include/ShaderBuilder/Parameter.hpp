@@ -25,8 +25,17 @@ namespace ShaderBuilder
 		 */
 		Parameter(Type data) : Super(data.getSource(), data.getSource().getUniqueIdentifier()), m_Data(Super::m_Source, Super::m_VariableName, data, true)
 		{
-			Super::m_Source.registerType<Type>();
+			Super::m_Source.template registerType<Type>();
 			Super::m_Source.getCurrentFunctionBlock().m_Parameters.insert(fmt::format("%{} = OpFunctionParameter {}", Super::m_VariableName, TypeTraits<Type>::Identifier));
+
+			// Device pointer parameters must declare whether the pointed memory can be aliased.
+			if constexpr (IsDevicePointerType<Type>)
+				Super::m_Source.insertAnnotation(fmt::format("OpDecorate %{} Aliased", Super::m_VariableName));
+
+			// Parameters are passed by value, so the data is not a variable.
+			// Parameters are values, so they are never loaded.
+			Super::markTemporary();
+			m_Data.markTemporary();
 		}
 
 		/**
@@ -84,4 +93,11 @@ namespace ShaderBuilder
 		static constexpr const char* Declaration = TypeTraits<Type>::Declaration;
 		static constexpr uint8_t Size = TypeTraits<Type>::Size;
 	};
+
+	/**
+	 * Is complex type boolean specialization.
+	 * Parameters are complex if their value types are, so the value types are registered before the parameter type.
+	 */
+	template<class Type>
+	constexpr bool IsCompexType<Parameter<Type>> = IsCompexType<Type>;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Builder.hpp"
+
+#include <tuple>
+
+namespace ShaderBuilder
+{
+	/**
+	 * Link and compile the stages of a pipeline.
+	 * Each stage is linked to the next one using Builder::linkNextStage(), so the outputs which the next stage does not read are removed before
+	 * compiling. The stages are linked from the last one, so the removed outputs of a stage can make the outputs of the previous stages unused too.
+	 * Linking is done on copies of the builders, so the given builders are left as they are and can be reused.
+	 *
+	 * For example,
+	 *
+	 * ```c++
+	 * const auto [vertexShader, fragmentShader] = CompilePipeline(OptimizationFlags::Release, vertexBuilder, fragmentBuilder);
+	 * ```
+	 *
+	 * @tparam Builders The builder types.
+	 * @param flags The optimization flags used to compile all the stages.
+	 * @param builders The builders of the stages, in the pipeline order. Make sure that their entry points are added.
+	 * @return The compiled binaries, in the same order as the builders.
+	 * @throws BuilderError If the interfaces of two stages do not match (see Builder::linkNextStage()).
+	 */
+	template<class... Builders>
+	[[nodiscard]] std::array<SPIRVBinary, sizeof...(Builders)> CompilePipeline(OptimizationFlags flags, const Builders&... builders)
+	{
+		static_assert(sizeof...(Builders) > 0, "A pipeline needs at least one stage!");
+		static_assert((std::is_base_of_v<Builder, Builders> && ...), "The stages of a pipeline must be builders!");
+
+		// Linking removes the unused inputs and outputs, so it is done on copies.
+		auto copies = std::tuple<Builders...>(builders...);
+		auto stages = std::apply([](Builders&... copy) { return std::array<Builder*, sizeof...(Builders)>{ &copy... }; }, copies);
+		for (uint64_t i = stages.size() - 1; i > 0; i--)
+			stages[i - 1]->linkNextStage(*stages[i]);
+
+		return std::apply([flags](const Builders&... copy) { return std::array<SPIRVBinary, sizeof...(Builders)>{ copy.compile(flags)... }; }, copies);
+	}
+} // namespace ShaderBuilder
@@ -0,0 +1,107 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "Scalar.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Runtime array class.
+	 * This is an array which size is only known at runtime. This can only be the last member of a storage buffer.
+	 *
+	 * @tparam Type The element type.
+	 */
+	template<class Type>
+	class RuntimeArray final : public DataType<RuntimeArray<Type>>
+	{
+	public:
+		using Super = DataType<RuntimeArray<Type>>;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 */
+		explicit RuntimeArray(SPIRVSource& source, const std::string& variableName) : Super(source, variableName) {}
+
+		/**
+		 * Access an element of the array.
+		 * This records an access chain in the current function, so the returned element can only be used within it.
+		 *
+		 * @param index The index of the element.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type operator[](uint32_t index)
+		{
+			Super::m_Source.storeConstant(index);
+			return getElement(fmt::format("%{}", GetConstantIdentifier(index)));
+		}
+
+		/**
+		 * Access an element of the array using an index computed in the shader.
+		 * This records an access chain in the current function, so the returned element can only be used within it.
+		 *
+		 * @param index The index of the element.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type operator[](const Scalar<uint32_t>& index) { return getElement(index.getValueIdentifier()); }
+
+	private:
+		/**
+		 * Get an element of the array using the index identifier.
+		 *
+		 * @param indexIdentifier The identifier of the index.
+		 * @return The element.
+		 */
+		[[nodiscard]] Type getElement(const std::string& indexIdentifier)
+		{
+			const auto arrayPointer = Super::getPointerIdentifier();
+			const auto pointerType = Super::m_Source.template registerPointerType<Type>(Super::m_StorageClass);
+
+			const auto identifier = Super::m_Source.getUniqueIdentifier();
+			Super::m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("%{} = OpAccessChain {} {} {}", identifier, pointerType, arrayPointer, indexIdentifier));
+
+			Super::decorateNonUniform(identifier);
+
+			auto element = Type(Super::m_Source, identifier);
+			element.setStorageClass(Super::m_StorageClass);
+
+			// Elements of non-uniform arrays are non-uniform too.
+			if (Super::isNonUniform())
+				element.markNonUniform();
+
+			return element;
+		}
+	};
+
+	/**
+	 * Runtime array type traits.
+	 *
+	 * @tparam ElementType The element type.
+	 */
+	template<class ElementType>
+	struct TypeTraits<RuntimeArray<ElementType>>
+	{
+		using Type = RuntimeArray<ElementType>;
+		using ValueTraits = TypeTraits<ElementType>;
+		static constexpr auto& RawIdentifier = StaticString<ConcatenateStrings("runtime_array_", ValueTraits::RawIdentifier)>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeRuntimeArray ", ValueTraits::Identifier)>;
+		static constexpr uint8_t Size = 0;
+	};
+
+	/**
+	 * Is complex type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsCompexType<RuntimeArray<Type>> = true;
+
+	/**
+	 * Is runtime array type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsRuntimeArrayType<RuntimeArray<Type>> = true;
+} // namespace ShaderBuilder
@@ -4,10 +4,56 @@
 
 #include "Storages/UniqueInstructionStorage.hpp"
 
+#include <optional>
 #include <stack>
+#include <string_view>
+#include <unordered_set>
 
 namespace ShaderBuilder
 {
+	/**
+	 * Fast math mode flags enum.
+	 * These let the driver make assumptions about the floating point values, which enables faster math.
+	 */
+	enum class FastMathMode : uint8_t
+	{
+		None = 0,
+		NotNaN = 1 << 0,
+		NotInf = 1 << 1,
+		NSZ = 1 << 2,
+		AllowRecip = 1 << 3,
+		AllowContract = 1 << 4,
+		AllowReassoc = 1 << 5,
+		AllowTransform = 1 << 6	// Requires AllowReassoc and AllowContract.
+	};
+
+	[[nodiscard]] constexpr FastMathMode operator|(FastMathMode lhs, FastMathMode rhs) { return static_cast<FastMathMode>(static_cast<std::underlying_type_t<FastMathMode>>(lhs) | static_cast<std::underlying_type_t<FastMathMode>>(rhs)); }
+	[[nodiscard]] constexpr bool operator&(FastMathMode lhs, FastMathMode rhs) { return static_cast<std::underlying_type_t<FastMathMode>>(lhs) & static_cast<std::underlying_type_t<FastMathMode>>(rhs); }
+
+	/**
+	 * Get the fast math mode string.
+	 *
+	 * @param mode The fast math mode flags.
+	 * @return The fast math mode string, like "NotNaN|NotInf".
+	 */
+	[[nodiscard]] std::string GetFastMathModeString(FastMathMode mode);
+
+	/**
+	 * Precision policy structure.
+	 * This defines the precision decorations which are added to the results of the operations.
+	 */
+	struct PrecisionPolicy final
+	{
+		// Allow the operations to be performed using at least 16 bits (like mediump).
+		bool m_RelaxedPrecision = false;
+
+		// Prevent floating point operations from being fused, like a multiplication and an addition to an fma. This cannot be used with a fast math mode.
+		bool m_NoContraction = false;
+
+		// The assumptions the driver can make about floating point operations. This requires SPV_KHR_float_controls2. Leave out AllowContract to prevent fusing.
+		FastMathMode m_FastMathMode = FastMathMode::None;
+	};
+
 	/**
 	 * Function block structure.
 	 * This stores information about a single function.
@@ -32,6 +78,18 @@ namespace ShaderBuilder
 		UniqueInstructionStorage m_Variables;
 
 		std::string m_Name;
+		PrecisionPolicy m_PrecisionPolicy;
+	};
+
+	/**
+	 * Interface attribute structure.
+	 * This stores an input or an output which is matched to the previous or the next stage using its location.
+	 */
+	struct InterfaceAttribute final
+	{
+		std::string m_Identifier;
+		std::string m_TypeIdentifier;
+		uint32_t m_Location = 0;
 	};
 
 	/**
@@ -89,6 +147,74 @@ namespace ShaderBuilder
 		 */
 		void insertExecutionMode(std::string&& instruction);
 
+		/**
+		 * Insert a new interface variable.
+		 * These are the global variables which are listed in the entry point's interface. From SPIR-V 1.4, this includes every global variable used by the entry point.
+		 *
+		 * @param identifier The identifier of the variable, without the leading %.
+		 * @return True if the variable was inserted now.
+		 * @return False if the variable was already inserted.
+		 */
+		bool insertInterfaceVariable(const std::string& identifier);
+
+		/**
+		 * Check if a variable is an interface variable.
+		 *
+		 * @param identifier The identifier of the variable, without the leading %.
+		 * @return True if the variable was inserted as an interface variable.
+		 * @return False if the variable is not an interface variable.
+		 */
+		[[nodiscard]] bool isInterfaceVariable(const std::string& identifier) const;
+
+		/**
+		 * Get the interface variables as a list of identifiers.
+		 *
+		 * @return The interface list, like " %1 %gl_GlobalInvocationID".
+		 */
+		[[nodiscard]] std::string getInterfaceVariables() const;
+
+		/**
+		 * Insert a new input attribute.
+		 *
+		 * @param attribute The attribute.
+		 */
+		void insertInputAttribute(InterfaceAttribute&& attribute);
+
+		/**
+		 * Insert a new output attribute.
+		 *
+		 * @param attribute The attribute.
+		 */
+		void insertOutputAttribute(InterfaceAttribute&& attribute);
+
+		/**
+		 * Get the input attributes.
+		 *
+		 * @return The input attributes.
+		 */
+		[[nodiscard]] const std::vector<InterfaceAttribute>& getInputAttributes() const { return m_InputAttributes; }
+
+		/**
+		 * Get the output attributes.
+		 *
+		 * @return The output attributes.
+		 */
+		[[nodiscard]] const std::vector<InterfaceAttribute>& getOutputAttributes() const { return m_OutputAttributes; }
+
+		/**
+		 * Remove output variables along with the instructions which only compute their values.
+		 * Outputs which are read back by the shader are kept. The global variables which are no longer used are removed too (see removeUnusedVariables()).
+		 *
+		 * @param identifiers The identifiers of the outputs, without the leading %.
+		 */
+		void removeOutputs(const std::vector<std::string>& identifiers);
+
+		/**
+		 * Remove the global variables which are not used by any function.
+		 * Their declarations, decorations and names are removed, and they are dropped from the entry point interfaces.
+		 */
+		void removeUnusedVariables();
+
 		/**
 		 * Insert a new debug name.
 		 *
@@ -116,6 +242,14 @@ namespace ShaderBuilder
 		 */
 		void insertInstruction(std::string&& instruction);
 
+		/**
+		 * Insert a new function declaration.
+		 * Declarations are functions without a body, which are resolved when linking (like imported functions).
+		 *
+		 * @param instruction The instruction.
+		 */
+		void insertFunctionDeclaration(std::string&& instruction);
+
 		/**
 		 * Create a new function block and push it to the stack.
 		 *
@@ -135,6 +269,59 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] void finishFunctionBlock();
 
+		/**
+		 * Inline a finished function into the current function block.
+		 * Only functions with a single block are inlined. Their variables and instructions are copied using new identifiers, and the parameters are replaced by the arguments.
+		 *
+		 * @param name The name of the function to inline.
+		 * @param arguments The identifiers of the argument values.
+		 * @param force Whether to inline the function even if it's larger than the inline threshold.
+		 * @return The identifier of the returned value if the function was inlined. This is empty if the function does not return a value.
+		 * @return std::nullopt if the function was not inlined.
+		 */
+		[[nodiscard]] std::optional<std::string> inlineFunction(const std::string& name, const std::vector<std::string>& arguments, bool force);
+
+		/**
+		 * Set the inline threshold.
+		 *
+		 * @param threshold The maximum number of instructions a function can have to be inlined. 0 disables inlining.
+		 */
+		void setInlineThreshold(uint32_t threshold) { m_InlineThreshold = threshold; }
+
+		/**
+		 * Get the inline threshold.
+		 *
+		 * @return The maximum number of instructions a function can have to be inlined.
+		 */
+		[[nodiscard]] uint32_t getInlineThreshold() const { return m_InlineThreshold; }
+
+		/**
+		 * Set the default precision policy.
+		 * New function blocks start with this policy.
+		 *
+		 * @param policy The precision policy.
+		 */
+		void setDefaultPrecisionPolicy(const PrecisionPolicy& policy) { m_DefaultPrecisionPolicy = policy; }
+
+		/**
+		 * Get the default precision policy.
+		 *
+		 * @return The precision policy.
+		 */
+		[[nodiscard]] const PrecisionPolicy& getDefaultPrecisionPolicy() const { return m_DefaultPrecisionPolicy; }
+
+		/**
+		 * Decorate a result using a precision policy.
+		 * RelaxedPrecision is applied to every numerical result, while NoContraction and FPFastMathMode are applied only to floating point arithmetic.
+		 *
+		 * @param identifier The identifier of the result, without the leading %.
+		 * @param instruction The instruction which produced the result.
+		 * @param typeIdentifier The type identifier of the result.
+		 * @param policy The precision policy.
+		 * @throws BuilderError If the policy uses both NoContraction and a fast math mode, or AllowTransform without AllowReassoc and AllowContract.
+		 */
+		void decoratePrecision(const std::string& identifier, std::string_view instruction, std::string_view typeIdentifier, const PrecisionPolicy& policy);
+
 	public:
 		/**
 		 * Get the source assembly.
@@ -171,6 +358,17 @@ namespace ShaderBuilder
 			if constexpr (IsCompexType<Type>)
 				registerType<typename TypeTraits<Type>::ValueTraits::Type>();
 
+			// Arrays declare their length using a constant.
+			if constexpr (IsArrayType<Type>)
+				storeConstant<uint32_t>(TypeTraits<Type>::Length);
+
+			// Device pointers need the pointee type and an array stride so they can be offset.
+			if constexpr (IsDevicePointerType<Type>)
+			{
+				registerType<typename TypeTraits<Type>::ValueTraits::Type>();
+				insertAnnotation(fmt::format("OpDecorate {} ArrayStride {}", TypeTraits<Type>::Identifier, TypeTraits<Type>::Stride));
+			}
+
 			insertType(fmt::format(FMT_STRING("{} = {}"), TypeTraits<Type>::Identifier, TypeTraits<Type>::Declaration));
 		}
 
@@ -222,6 +420,25 @@ namespace ShaderBuilder
 			insertType(fmt::format("%array_{}_{} = OpTypeArray {} %{}", TypeTraits<ValueType>::RawIdentifier, Size, TypeTraits<ValueType>::Identifier, GetConstantIdentifier<uint32_t>(Size)));
 		}
 
+		/**
+		 * Register a pointer type.
+		 * The identifier will be pointer_<storage class>_<type identifier>.
+		 *
+		 * @tparam Type The type the pointer points to.
+		 * @param storageClass The storage class of the pointer.
+		 * @return The pointer type identifier.
+		 */
+		template<class Type>
+		std::string registerPointerType(const char* storageClass)
+		{
+			registerType<Type>();
+
+			auto identifier = fmt::format("%pointer_{}_{}", storageClass, TypeTraits<Type>::RawIdentifier);
+			insertType(fmt::format("{} = OpTypePointer {} {}", identifier, storageClass, TypeTraits<Type>::Identifier));
+
+			return identifier;
+		}
+
 		/**
 		 * Get type identifier.
 		 *
@@ -245,7 +462,8 @@ namespace ShaderBuilder
 		template<class Type, class... Types>
 		[[nodiscard]] constexpr std::string getTypeIdentifiers()
 		{
-			registerType<Type>();
+			// Register the wrapped type, so parameters register their value types too.
+			registerType<typename TypeTraits<Type>::Type>();
 			if constexpr (sizeof...(Types) > 0)
 				return fmt::format("{} {}", TypeTraits<Type>::Identifier, getTypeIdentifiers<Types...>());
 
@@ -327,12 +545,44 @@ namespace ShaderBuilder
 				return TypeTraits<MemberType>::Identifier;
 		}
 
+	private:
+		/**
+		 * Infer the capabilities and extensions required by the used types.
+		 * The 64 bit types always need their capabilities. The 8 and 16 bit types only need the storage capabilities when they are only loaded, stored and converted in block and interface storage classes.
+		 *
+		 * @param capabilities The capabilities to insert to.
+		 * @param extensions The extensions to insert to.
+		 */
+		void inferCapabilities(UniqueInstructionStorage& capabilities, UniqueInstructionStorage& extensions) const;
+
+		/**
+		 * Remove the variables which are only written to, along with the stores and the access chains which write to them.
+		 *
+		 * @param candidates The identifiers of the variables to check, without the leading %.
+		 * @return True if any instruction was removed.
+		 */
+		bool removeWriteOnlyVariables(const std::unordered_set<std::string>& candidates);
+
+		/**
+		 * Remove the instructions whose results are not used and which do not have any side effects.
+		 *
+		 * @return True if any instruction was removed.
+		 */
+		bool removeUnusedResults();
+
+		/**
+		 * Remove the decorations and the names of removed identifiers.
+		 *
+		 * @param identifiers The removed identifiers, without the leading %.
+		 */
+		void removeDecorationsAndNames(const std::unordered_set<std::string>& identifiers);
+
 	private:
 		std::stack<FunctionBlock> m_FunctionBlockStack;
 		std::vector<FunctionBlock> m_FunctionBlocks;
 
-		InstructionStorage m_Capabilities;
-		InstructionStorage m_Extensions;
+		UniqueInstructionStorage m_Capabilities;
+		UniqueInstructionStorage m_Extensions;
 		InstructionStorage m_ExtendedInstructions;
 
 		std::string m_MemoryModel;
@@ -340,11 +590,18 @@ namespace ShaderBuilder
 		InstructionStorage m_EntryPoints;
 		InstructionStorage m_ExecutionModes;
 		InstructionStorage m_DebugNames;
-		InstructionStorage m_Annotations;
+		UniqueInstructionStorage m_Annotations;
 		UniqueInstructionStorage m_Types;
 
 		InstructionStorage m_FunctionDeclarations;
 
+		std::vector<std::string> m_InterfaceVariables;
+		std::vector<InterfaceAttribute> m_InputAttributes;
+		std::vector<InterfaceAttribute> m_OutputAttributes;
+
+		PrecisionPolicy m_DefaultPrecisionPolicy;
+
 		uint64_t m_UniqueID = 1;
+		uint32_t m_InlineThreshold = 0;
 	};
 } // namespace ShaderBuilder
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include "DataType.hpp"
+
+namespace ShaderBuilder
+{
+	/**
+	 * Scalar data type.
+	 * This is a single value (like a float or an integer) which lives in the shader, like the result of a dot product.
+	 *
+	 * @tparam Type The value type. Default is float.
+	 */
+	template<class Type = float>
+	class Scalar final : public DataType<Scalar<Type>>
+	{
+	public:
+		using Super = DataType<Scalar<Type>>;
+		using Traits = TypeTraits<Scalar<Type>>;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 */
+		explicit Scalar(SPIRVSource& source, const std::string& variableName) : Super(source, variableName) {}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param other The other to copy the data from.
+		 * @param shallow Whether we need a shallow copy or not. Default is false. If a shallow copy is performed, no instructions are recorded.
+		 */
+		explicit Scalar(SPIRVSource& source, const std::string& variableName, const Scalar& other, bool shallow = false) : Super(source, variableName)
+		{
+			// If we just need a shallow copy, return without storing any instructions.
+			if (shallow)
+				return;
+
+			Super::copyFrom(other);
+		}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param value The value to initialize the type with.
+		 */
+		explicit Scalar(SPIRVSource& source, const std::string& variableName, Type value) : Super(source, variableName)
+		{
+			source.storeConstant(value);
+
+			// Initialization happens only within function definitions, so we can simply assign it there.
+			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %{}", variableName, GetConstantIdentifier(value)));
+		}
+
+		/**
+		 * Assignment operator.
+		 *
+		 * @param other The other scalar.
+		 * @return The altered scalar reference.
+		 */
+		Scalar& operator=(const Scalar& other)
+		{
+			Super::copyFrom(other);
+			return *this;
+		}
+	};
+
+	/**
+	 * Scalar type traits.
+	 * The scalar shares the type declaration with its value type.
+	 *
+	 * @tparam ValueType The value type.
+	 */
+	template<class ValueType>
+	struct TypeTraits<Scalar<ValueType>> : TypeTraits<ValueType>
+	{
+		using Type = Scalar<ValueType>;
+		using ValueTraits = TypeTraits<ValueType>;
+	};
+
+	/**
+	 * Is scalar type boolean specialization
+	 */
+	template<class Type>
+	constexpr bool IsScalarType<Scalar<Type>> = true;
+} // namespace ShaderBuilder
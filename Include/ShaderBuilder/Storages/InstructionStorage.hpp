@@ -38,6 +38,34 @@ namespace ShaderBuilder
 		 */
 		void setShouldRecord(bool shouldRecord) { m_ShouldRecord = shouldRecord; }
 
+		/**
+		 * Remove the instructions which satisfy a predicate.
+		 *
+		 * @tparam Predicate The predicate type.
+		 * @param predicate The predicate, which returns true for the instructions to remove.
+		 * @return The number of removed instructions.
+		 */
+		template<class Predicate>
+		uint64_t removeIf(Predicate&& predicate)
+		{
+			return std::erase_if(m_Instructions, [this, &predicate](const std::string& instruction)
+				{
+					if (!predicate(instruction))
+						return false;
+
+					unregisterInstruction(instruction);
+					return true;
+				}
+			);
+		}
+
+		/**
+		 * Get the number of stored instructions.
+		 *
+		 * @return The instruction count.
+		 */
+		[[nodiscard]] uint64_t size() const { return m_Instructions.size(); }
+
 		/**
 		 * Get the begin iterator.
 		 *
@@ -66,6 +94,14 @@ namespace ShaderBuilder
 		 */
 		[[nodiscard]] decltype(auto) end() const { return m_Instructions.end(); }
 
+	protected:
+		/**
+		 * Unregister an instruction which is being removed.
+		 *
+		 * @param instruction The removed instruction.
+		 */
+		virtual void unregisterInstruction([[maybe_unused]] const std::string& instruction) {}
+
 	protected:
 		std::vector<std::string> m_Instructions;
 		bool m_ShouldRecord = true;
@@ -40,6 +40,19 @@ namespace ShaderBuilder
 		}
 
 	private:
+		/**
+		 * Unregister an instruction which is being removed.
+		 * This allows the same instruction to be inserted again.
+		 *
+		 * @param instruction The removed instruction.
+		 */
+		void unregisterInstruction(const std::string& instruction) override
+		{
+			const auto hash = GenerateHash(instruction.data(), instruction.size());
+			if (const auto itr = std::lower_bound(m_Availability.begin(), m_Availability.end(), hash); itr != m_Availability.end() && *itr == hash)
+				m_Availability.erase(itr);
+		}
+
 		/**
 		 * Register a new instruction.
 		 *
@@ -0,0 +1,130 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ShaderBuilder
+{
+	/**
+	 * String literal structure.
+	 * This is a fixed size, null terminated string which can be created at compile time. This is used to generate the type
+	 * identifiers and declarations of templated types. Use StaticString to get a character array out of it.
+	 *
+	 * @tparam Size The size of the string including the null terminator.
+	 */
+	template<size_t Size>
+	struct StringLiteral final
+	{
+		/**
+		 * Default constructor.
+		 */
+		constexpr StringLiteral() = default;
+
+		/**
+		 * Get the length of the string without the null terminator.
+		 *
+		 * @return The length.
+		 */
+		[[nodiscard]] static constexpr size_t length() { return Size - 1; }
+
+		/**
+		 * Subscript operator.
+		 *
+		 * @param index The index of the character.
+		 * @return The character.
+		 */
+		[[nodiscard]] constexpr char operator[](size_t index) const { return m_String[index]; }
+
+		char m_String[Size] = {};
+	};
+
+	/**
+	 * String length structure.
+	 * This is used to get the length of a compile time string without the null terminator.
+	 *
+	 * @tparam Type The string type.
+	 */
+	template<class Type>
+	struct StringLength;
+
+	/**
+	 * String length structure specialization for character arrays.
+	 *
+	 * @tparam Size The size of the array.
+	 */
+	template<size_t Size>
+	struct StringLength<char[Size]> { static constexpr size_t Value = Size - 1; };
+
+	/**
+	 * String length structure specialization for string literals.
+	 *
+	 * @tparam Size The size of the string literal.
+	 */
+	template<size_t Size>
+	struct StringLength<StringLiteral<Size>> { static constexpr size_t Value = Size - 1; };
+
+	/**
+	 * Concatenate multiple compile time strings.
+	 *
+	 * @tparam Strings The string types. These can be character arrays or string literals.
+	 * @param strings The strings to concatenate.
+	 * @return The concatenated string literal.
+	 */
+	template<class... Strings>
+	[[nodiscard]] constexpr auto ConcatenateStrings(const Strings&... strings)
+	{
+		StringLiteral<(StringLength<Strings>::Value + ...) + 1> result;
+
+		size_t index = 0;
+		auto append = [&result, &index](const auto& string, size_t length)
+		{
+			for (size_t i = 0; i < length; i++)
+				result.m_String[index++] = string[i];
+		};
+		(append(strings, StringLength<Strings>::Value), ...);
+
+		return result;
+	}
+
+	/**
+	 * Static string variable.
+	 * This stores a string literal as a template parameter object, so the characters can be referenced as a regular character
+	 * array. Character arrays are formatted and converted to strings like any other string literal.
+	 *
+	 * @tparam Literal The string literal.
+	 */
+	template<auto Literal>
+	constexpr const auto& StaticString = Literal.m_String;
+
+	/**
+	 * Convert an unsigned integer to a compile time string.
+	 *
+	 * @tparam Value The value to convert.
+	 * @return The string literal containing the decimal digits.
+	 */
+	template<uint64_t Value>
+	[[nodiscard]] constexpr auto ToStringLiteral()
+	{
+		constexpr auto digitCount = []
+		{
+			size_t count = 1;
+			for (auto remaining = Value / 10; remaining > 0; remaining /= 10)
+				count++;
+
+			return count;
+		}();
+
+		StringLiteral<digitCount + 1> result;
+
+		auto remaining = Value;
+		for (size_t i = digitCount; i > 0; i--)
+		{
+			result.m_String[i - 1] = static_cast<char>('0' + remaining % 10);
+			remaining /= 10;
+		}
+
+		return result;
+	}
+} // namespace ShaderBuilder
@@ -2,7 +2,10 @@
 
 #pragma once
 
-#include <cstdint>
+#include "StringLiteral.hpp"
+#include "Half.hpp"
+
+#include <type_traits>
 
 namespace ShaderBuilder
 {
@@ -39,133 +42,138 @@ namespace ShaderBuilder
 	};
 
 	/**
-	 * 8 bit signed integer type traits.
+	 * Get the raw identifier of an integer type.
+	 *
+	 * @tparam Integer The integer type.
+	 * @return The identifier string literal, like int32 or uint8.
 	 */
-	template <>
-	struct TypeTraits<int8_t>
+	template<class Integer>
+	[[nodiscard]] constexpr auto GetIntegerIdentifier()
 	{
-		using Type = int8_t;
-		static constexpr const char RawIdentifier[] = "int8";
-		static constexpr const char Identifier[] = "%int8";
-		static constexpr const char Declaration[] = "OpTypeInt 8 1";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+		if constexpr (std::is_signed_v<Integer>)
+			return ConcatenateStrings("int", ToStringLiteral<sizeof(Integer) * 8>());
 
-	/**
-	 * 8 bit unsigned integer type traits.
-	 */
-	template <>
-	struct TypeTraits<uint8_t>
-	{
-		using Type = uint8_t;
-		static constexpr const char RawIdentifier[] = "uint8";
-		static constexpr const char Identifier[] = "%uint8";
-		static constexpr const char Declaration[] = "OpTypeInt 8 0";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+		else
+			return ConcatenateStrings("uint", ToStringLiteral<sizeof(Integer) * 8>());
+	}
 
 	/**
-	 * 16 bit signed integer type traits.
+	 * Integer type traits structure.
+	 * This generates the traits of an integer type using its size and signedness.
+	 *
+	 * @tparam Integer The integer type.
 	 */
-	template <>
-	struct TypeTraits<int16_t>
+	template<class Integer>
+	struct IntegerTraits
 	{
-		using Type = int16_t;
-		static constexpr const char RawIdentifier[] = "int16";
-		static constexpr const char Identifier[] = "%int16";
-		static constexpr const char Declaration[] = "OpTypeInt 16 1";
+		using Type = Integer;
+		static constexpr auto& RawIdentifier = StaticString<GetIntegerIdentifier<Integer>()>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeInt ", ToStringLiteral<sizeof(Integer) * 8>(), " ", ToStringLiteral<std::is_signed_v<Integer>>())>;
 		static constexpr uint8_t Size = sizeof(Type);
 	};
 
 	/**
-	 * 16 bit unsigned integer type traits.
+	 * Get the raw identifier of a floating point type.
+	 *
+	 * @tparam Float The floating point type.
+	 * @return The identifier string literal, like float16, float or double.
 	 */
-	template <>
-	struct TypeTraits<uint16_t>
+	template<class Float>
+	[[nodiscard]] constexpr auto GetFloatIdentifier()
 	{
-		using Type = uint16_t;
-		static constexpr const char RawIdentifier[] = "uint16";
-		static constexpr const char Identifier[] = "%uint16";
-		static constexpr const char Declaration[] = "OpTypeInt 16 0";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+		if constexpr (sizeof(Float) == sizeof(double))
+			return ConcatenateStrings("double");
+
+		else if constexpr (sizeof(Float) == sizeof(half))
+			return ConcatenateStrings("float16");
+
+		else
+			return ConcatenateStrings("float");
+	}
 
 	/**
-	 * 32 bit signed integer type traits.
+	 * Floating point type traits structure.
+	 * This generates the traits of a floating point type using its size.
+	 *
+	 * @tparam Float The floating point type.
 	 */
-	template <>
-	struct TypeTraits<int32_t>
+	template<class Float>
+	struct FloatTraits
 	{
-		using Type = int32_t;
-		static constexpr const char RawIdentifier[] = "int32";
-		static constexpr const char Identifier[] = "%int32";
-		static constexpr const char Declaration[] = "OpTypeInt 32 1";
+		using Type = Float;
+		static constexpr auto& RawIdentifier = StaticString<GetFloatIdentifier<Float>()>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeFloat ", ToStringLiteral<sizeof(Float) * 8>())>;
 		static constexpr uint8_t Size = sizeof(Type);
 	};
 
 	/**
-	 * 32 bit unsigned integer type traits.
+	 * Integer and floating point type traits.
 	 */
-	template <>
-	struct TypeTraits<uint32_t>
-	{
-		using Type = uint32_t;
-		static constexpr const char RawIdentifier[] = "uint32";
-		static constexpr const char Identifier[] = "%uint32";
-		static constexpr const char Declaration[] = "OpTypeInt 32 0";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+	template<> struct TypeTraits<int8_t> : IntegerTraits<int8_t> {};
+	template<> struct TypeTraits<uint8_t> : IntegerTraits<uint8_t> {};
+	template<> struct TypeTraits<int16_t> : IntegerTraits<int16_t> {};
+	template<> struct TypeTraits<uint16_t> : IntegerTraits<uint16_t> {};
+	template<> struct TypeTraits<int32_t> : IntegerTraits<int32_t> {};
+	template<> struct TypeTraits<uint32_t> : IntegerTraits<uint32_t> {};
+	template<> struct TypeTraits<int64_t> : IntegerTraits<int64_t> {};
+	template<> struct TypeTraits<uint64_t> : IntegerTraits<uint64_t> {};
+	template<> struct TypeTraits<float> : FloatTraits<float> {};
+	template<> struct TypeTraits<double> : FloatTraits<double> {};
+	template<> struct TypeTraits<half> : FloatTraits<half> {};
 
 	/**
-	 * 64 bit signed integer type traits.
+	 * Is floating point boolean.
+	 * This is the same as std::is_floating_point_v, but it also includes half.
 	 */
-	template <>
-	struct TypeTraits<int64_t>
-	{
-		using Type = int64_t;
-		static constexpr const char RawIdentifier[] = "int64";
-		static constexpr const char Identifier[] = "%int64";
-		static constexpr const char Declaration[] = "OpTypeInt 64 1";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+	template<class Type>
+	constexpr bool IsFloatingPoint = std::is_floating_point_v<Type>;
 
 	/**
-	 * 64 bit unsigned integer type traits.
+	 * Is floating point boolean specialization for half.
 	 */
-	template <>
-	struct TypeTraits<uint64_t>
-	{
-		using Type = uint64_t;
-		static constexpr const char RawIdentifier[] = "uint64";
-		static constexpr const char Identifier[] = "%uint64";
-		static constexpr const char Declaration[] = "OpTypeInt 64 0";
-		static constexpr uint8_t Size = sizeof(Type);
-	};
+	template<>
+	constexpr bool IsFloatingPoint<half> = true;
 
 	/**
-	 * Float type traits.
+	 * Vector type traits structure.
+	 * This generates the traits of a vector using the value type and the number of components.
+	 *
+	 * @tparam Vector The vector type.
+	 * @tparam Value The value type of the vector.
+	 * @tparam ComponentCount The number of components in the vector.
 	 */
-	template <>
-	struct TypeTraits<float>
+	template<class Vector, class Value, uint8_t ComponentCount>
+	struct VectorTraits
 	{
-		using Type = float;
-		static constexpr const char RawIdentifier[] = "float";
-		static constexpr const char Identifier[] = "%float";
-		static constexpr const char Declaration[] = "OpTypeFloat 32";
-		static constexpr uint8_t Size = sizeof(Type);
+		using Type = Vector;
+		using ValueTraits = TypeTraits<Value>;
+		static constexpr auto& RawIdentifier = StaticString<ConcatenateStrings("vec", ToStringLiteral<ComponentCount>(), "_", ValueTraits::RawIdentifier)>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeVector ", ValueTraits::Identifier, " ", ToStringLiteral<ComponentCount>())>;
+		static constexpr uint8_t Size = sizeof(Value) * ComponentCount;
 	};
 
 	/**
-	 * Double type traits.
+	 * Matrix type traits structure.
+	 * This generates the traits of a matrix using the column type and the number of columns.
+	 *
+	 * @tparam Matrix The matrix type.
+	 * @tparam Column The column vector type.
+	 * @tparam Columns The number of columns in the matrix.
 	 */
-	template <>
-	struct TypeTraits<double>
+	template<class Matrix, class Column, uint8_t Columns>
+	struct MatrixTraits
 	{
-		using Type = double;
-		static constexpr const char RawIdentifier[] = "double";
-		static constexpr const char Identifier[] = "%double";
-		static constexpr const char Declaration[] = "OpTypeFloat 64";
-		static constexpr uint8_t Size = sizeof(Type);
+		using Type = Matrix;
+		using ColumnTraits = TypeTraits<Column>;
+		using ValueTraits = ColumnTraits;
+		static constexpr auto& RawIdentifier = StaticString<ConcatenateStrings("mat", ToStringLiteral<Columns>(), "_", ColumnTraits::ValueTraits::RawIdentifier)>;
+		static constexpr auto& Identifier = StaticString<ConcatenateStrings("%", RawIdentifier)>;
+		static constexpr auto& Declaration = StaticString<ConcatenateStrings("OpTypeMatrix ", ColumnTraits::Identifier, " ", ToStringLiteral<Columns>())>;
+		static constexpr uint8_t ColumnCount = Columns;
+		static constexpr uint8_t Size = ColumnTraits::Size * Columns;
 	};
 
 	/**
@@ -174,6 +182,45 @@ namespace ShaderBuilder
 	template<class Type>
 	constexpr bool IsCompexType = false;
 
+	/**
+	 * Is matrix type boolean.
+	 */
+	template<class Type>
+	constexpr bool IsMatrixType = false;
+
+	/**
+	 * Is runtime array type boolean.
+	 */
+	template<class Type>
+	constexpr bool IsRuntimeArrayType = false;
+
+	/**
+	 * Is array type boolean.
+	 * This is true for arrays which length is known when building the shader.
+	 */
+	template<class Type>
+	constexpr bool IsArrayType = false;
+
+	/**
+	 * Is vector type boolean.
+	 */
+	template<class Type>
+	constexpr bool IsVectorType = false;
+
+	/**
+	 * Is scalar type boolean.
+	 * This is true for the scalar data type (Scalar<Type>), not the value types themselves.
+	 */
+	template<class Type>
+	constexpr bool IsScalarType = false;
+
+	/**
+	 * Is device pointer type boolean.
+	 * This is true for pointers to the physical storage buffer storage class (DevicePointer<Type>).
+	 */
+	template<class Type>
+	constexpr bool IsDevicePointerType = false;
+
 
 	/**
 	 * Member variable type structure.
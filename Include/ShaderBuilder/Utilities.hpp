@@ -21,6 +21,8 @@ namespace ShaderBuilder
 	 * Get the constant value's identifier.
 	 * Make sure that the type is registered.
 	 *
+	 * Identifiers can only contain letters, digits and underscores, so signs and decimal points are replaced (-0.5 becomes n0_5).
+	 *
 	 * @tparam Type The type of the value.
 	 * @param value The constant value.
 	 * @return The identifier string.
@@ -28,6 +30,29 @@ namespace ShaderBuilder
 	template<class Type>
 	[[nodiscard]] static std::string GetConstantIdentifier(const Type& value)
 	{
-		return fmt::format("const_{}_{}", TypeTraits<Type>::RawIdentifier, value);
+		auto identifier = fmt::format("const_{}_", TypeTraits<Type>::RawIdentifier);
+		for (const auto character : fmt::format("{}", value))
+		{
+			switch (character)
+			{
+			case '-':
+				identifier += 'n';
+				break;
+
+			case '+':
+				identifier += 'p';
+				break;
+
+			case '.':
+				identifier += '_';
+				break;
+
+			default:
+				identifier += character;
+				break;
+			}
+		}
+
+		return identifier;
 	}
 } // namespace ShaderBuilder
\ No newline at end of file
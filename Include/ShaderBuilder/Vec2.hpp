@@ -2,7 +2,7 @@
 
 #pragma once
 
-#include "DataType.hpp"
+#include "Operations.hpp"
 #include "Utilities.hpp"
 
 namespace ShaderBuilder
@@ -72,28 +72,12 @@ namespace ShaderBuilder
 		 * @param shallow Whether we need a shallow copy or not. Default is false. If a shallow copy is performed, no instructions are recorded.
 		 */
 		explicit Vec2(SPIRVSource& source, const std::string& variableName, const Vec2& other, bool shallow = false) : Super(source, variableName), x(other.x), y(other.y)
-		{			
+		{
 			// If we just need a shallow copy, return without storing any instructions.
 			if (shallow)
 				return;
 
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, other.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {}", compositeIdentifier, Traits::Identifier, xIdentifier, yIdentifier));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::copyFrom(other);
 		}
 
 		/**
@@ -105,18 +89,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec2(SPIRVSource& source, const std::string& variableName, Type value) : Super(source, variableName), x(value), y(value)
 		{
-			const auto identifier = GetConstantIdentifier<uint64_t>(value);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", identifier, TypeTraits<Type>::Identifier, value));
-
-			// Setup the vector constant.
-			const Type vector[] = { value, value };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{}", hash, Traits::Identifier, identifier, identifier));
-
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
+			Super::storeConstantComposite(value, value);
 		}
 
 		/**
@@ -129,21 +102,25 @@ namespace ShaderBuilder
 		 */
 		explicit Vec2(SPIRVSource& source, const std::string& variableName, Type x, Type y) : Super(source, variableName), x(x), y(y)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-			const auto yIdentifier = GetConstantIdentifier<uint64_t>(y);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", yIdentifier, TypeTraits<Type>::Identifier, y));
+			Super::storeConstantComposite(x, y);
+		}
 
-			// Setup the vector constant.
-			const Type vector[] = { x, y };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{}", hash, Traits::Identifier, xIdentifier, yIdentifier));
+		/**
+		 * Swizzle the vector.
+		 * The components can be given using any of the xyzw, rgba or stpq sets and are recorded as a single instruction.
+		 *
+		 * @tparam Components The components to select.
+		 * @return The resulting temporary.
+		 */
+		template<char... Components>
+		[[nodiscard]] auto swizzle() const { return Swizzle<Components...>(*this); }
 
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
-		}
+		/**
+		 * Get the yx swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto yx() const { return swizzle<'y', 'x'>(); }
 
 		/**
 		 * Assignment operator.
@@ -153,7 +130,7 @@ namespace ShaderBuilder
 		 */
 		Vec2& operator=(const Vec2& other)
 		{
-			Super::m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpCopyMemory %{} %{}", Super::m_VariableName, other.getName()));
+			Super::copyFrom(other);
 
 			x = other.x;
 			y = other.y;
@@ -171,148 +148,30 @@ namespace ShaderBuilder
 	};
 
 	/**
-	 * Vec2 int8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<int8_t>>
-	{
-		using Type = Vec2<int8_t>;
-		using ValueTraits = TypeTraits<int8_t>;
-		static constexpr const char RawIdentifier[] = "vec2_int8";
-		static constexpr const char Identifier[] = "%vec2_int8";
-		static constexpr const char Declaration[] = "OpTypeVector %int8 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 uint8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<uint8_t>>
-	{
-		using Type = Vec2<uint8_t>;
-		using ValueTraits = TypeTraits<uint8_t>;
-		static constexpr const char RawIdentifier[] = "vec2_uint8";
-		static constexpr const char Identifier[] = "%vec2_uint8";
-		static constexpr const char Declaration[] = "OpTypeVector %uint8 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 int16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<int16_t>>
-	{
-		using Type = Vec2<int16_t>;
-		using ValueTraits = TypeTraits<int16_t>;
-		static constexpr const char RawIdentifier[] = "vec2_int16";
-		static constexpr const char Identifier[] = "%vec2_int16";
-		static constexpr const char Declaration[] = "OpTypeVector %int16 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 uint16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<uint16_t>>
-	{
-		using Type = Vec2<uint16_t>;
-		using ValueTraits = TypeTraits<uint16_t>;
-		static constexpr const char RawIdentifier[] = "vec2_uint16";
-		static constexpr const char Identifier[] = "%vec2_uint16";
-		static constexpr const char Declaration[] = "OpTypeVector %uint16 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 int32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<int32_t>>
-	{
-		using Type = Vec2<int32_t>;
-		using ValueTraits = TypeTraits<int32_t>;
-		static constexpr const char RawIdentifier[] = "vec2_int32";
-		static constexpr const char Identifier[] = "%vec2_int32";
-		static constexpr const char Declaration[] = "OpTypeVector %int32 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 uint32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<uint32_t>>
-	{
-		using Type = Vec2<uint32_t>;
-		using ValueTraits = TypeTraits<uint32_t>;
-		static constexpr const char RawIdentifier[] = "vec2_uint32";
-		static constexpr const char Identifier[] = "%vec2_uint32";
-		static constexpr const char Declaration[] = "OpTypeVector %uint32 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 int64_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec2<int64_t>>
-	{
-		using Type = Vec2<int64_t>;
-		using ValueTraits = TypeTraits<int64_t>;
-		static constexpr const char RawIdentifier[] = "vec2_int64";
-		static constexpr const char Identifier[] = "%vec2_int64";
-		static constexpr const char Declaration[] = "OpTypeVector %int64 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
-
-	/**
-	 * Vec2 uint64_t specialization.
+	 * Vec2 type traits.
+	 *
+	 * @tparam Type The value type.
 	 */
-	template<>
-	struct TypeTraits<Vec2<uint64_t>>
-	{
-		using Type = Vec2<uint64_t>;
-		using ValueTraits = TypeTraits<uint64_t>;
-		static constexpr const char RawIdentifier[] = "vec2_uint64";
-		static constexpr const char Identifier[] = "%vec2_uint64";
-		static constexpr const char Declaration[] = "OpTypeVector %uint64 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
+	template<class Type>
+	struct TypeTraits<Vec2<Type>> : VectorTraits<Vec2<Type>, Type, 2> {};
 
 	/**
-	 * Vec2 float specialization.
+	 * Vector of specialization for 2 components.
+	 *
+	 * @tparam Value The component value type.
 	 */
-	template<>
-	struct TypeTraits<Vec2<float>>
-	{
-		using Type = Vec2<float>;
-		using ValueTraits = TypeTraits<float>;
-		static constexpr const char RawIdentifier[] = "vec2_float";
-		static constexpr const char Identifier[] = "%vec2_float";
-		static constexpr const char Declaration[] = "OpTypeVector %float 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
+	template<class Value>
+	struct VectorOf<Value, 2> { using Type = Vec2<Value>; };
 
 	/**
-	 * Vec2 double specialization.
+	 * Is complex type boolean specialization
 	 */
-	template<>
-	struct TypeTraits<Vec2<double>>
-	{
-		using Type = Vec2<double>;
-		using ValueTraits = TypeTraits<double>;
-		static constexpr const char RawIdentifier[] = "vec2_double";
-		static constexpr const char Identifier[] = "%vec2_double";
-		static constexpr const char Declaration[] = "OpTypeVector %double 2";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 2;
-	};
+	template<class Type>
+	constexpr bool IsCompexType<Vec2<Type>> = true;
 
 	/**
-	 * Is complex type boolean specialization
+	 * Is vector type boolean specialization
 	 */
 	template<class Type>
-	constexpr bool IsCompexType<Vec2<Type>> = true;
+	constexpr bool IsVectorType<Vec2<Type>> = true;
 } // namespace ShaderBuilder
\ No newline at end of file
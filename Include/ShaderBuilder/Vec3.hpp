@@ -73,30 +73,12 @@ namespace ShaderBuilder
 		 * @param shallow Whether we need a shallow copy or not. Default is false. If a shallow copy is performed, no instructions are recorded.
 		 */
 		explicit Vec3(SPIRVSource& source, const std::string& variableName, const Vec3& other, bool shallow = false) : Super(source, variableName), x(other.x), y(other.y), z(other.z)
-		{			
+		{
 			// If we just need a shallow copy, return without storing any instructions.
 			if (shallow)
 				return;
 
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec3<Type>>::Identifier, other.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 3", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {} {}", compositeIdentifier, Traits::Identifier, xIdentifier, yIdentifier, zIdentifier));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::copyFrom(other);
 		}
 
 		/**
@@ -108,22 +90,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec3(SPIRVSource& source, const std::string& variableName, Type value) : Super(source, variableName), x(value), y(value), z(value)
 		{
-			const auto identifier = GetConstantIdentifier<uint64_t>(value);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", identifier, TypeTraits<Type>::Identifier, value));
-
-			// Setup the vector constant.
-			const Type vector[] = { value, value, value };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{} %{}", hash, Traits::Identifier
-				, identifier
-				, identifier
-				, identifier
-			));
-
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
+			Super::storeConstantComposite(value, value, value);
 		}
 
 		/**
@@ -137,26 +104,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec3(SPIRVSource& source, const std::string& variableName, Type x, Type y, Type z) : Super(source, variableName), x(x), y(y), z(z)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-			const auto yIdentifier = GetConstantIdentifier<uint64_t>(y);
-			const auto zIdentifier = GetConstantIdentifier<uint64_t>(z);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", yIdentifier, TypeTraits<Type>::Identifier, y));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", zIdentifier, TypeTraits<Type>::Identifier, z));
-
-			// Setup the vector constant.
-			const Type vector[] = { x, y, z };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{} %{}", hash, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-			));
-
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
+			Super::storeConstantComposite(x, y, z);
 		}
 
 		/**
@@ -169,28 +117,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec3(SPIRVSource& source, const std::string& variableName, const Vec2<Type>& vec, Type z) : Super(source, variableName), x(vec.x), y(vec.y), z(z)
 		{
-			const auto zIdentifier = GetConstantIdentifier<uint64_t>(z);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", zIdentifier, TypeTraits<Type>::Identifier, z));
-
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, vec.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {} %{}", compositeIdentifier, Traits::Identifier, xIdentifier, yIdentifier, zIdentifier));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::storeComposite(fmt::format("{} {}", vec.getValueIdentifier(), Super::storeConstant(z)));
 		}
 
 		/**
@@ -203,29 +130,46 @@ namespace ShaderBuilder
 		 */
 		explicit Vec3(SPIRVSource& source, const std::string& variableName, Type x, const Vec2<Type>& vec) : Super(source, variableName), x(x), y(vec.x), z(vec.y)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
+			Super::storeComposite(fmt::format("{} {}", Super::storeConstant(x), vec.getValueIdentifier()));
+		}
 
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, vec.getName()));
+		/**
+		 * Swizzle the vector.
+		 * The components can be given using any of the xyzw, rgba or stpq sets and are recorded as a single instruction.
+		 *
+		 * @tparam Components The components to select.
+		 * @return The resulting temporary.
+		 */
+		template<char... Components>
+		[[nodiscard]] auto swizzle() const { return Swizzle<Components...>(*this); }
 
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
+		/**
+		 * Get the xy swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto xy() const { return swizzle<'x', 'y'>(); }
 
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
+		/**
+		 * Get the xz swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto xz() const { return swizzle<'x', 'z'>(); }
 
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} %{} {} {}", compositeIdentifier, Traits::Identifier, xIdentifier, yIdentifier, zIdentifier));
+		/**
+		 * Get the yz swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto yz() const { return swizzle<'y', 'z'>(); }
 
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
-		}
+		/**
+		 * Get the zyx swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto zyx() const { return swizzle<'z', 'y', 'x'>(); }
 
 		/**
 		 * Assignment operator.
@@ -235,7 +179,7 @@ namespace ShaderBuilder
 		 */
 		Vec3& operator=(const Vec3& other)
 		{
-			Super::m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpCopyMemory %{} %{}", Super::m_VariableName, other.getName()));
+			Super::copyFrom(other);
 
 			x = other.x;
 			y = other.y;
@@ -254,148 +198,30 @@ namespace ShaderBuilder
 	};
 
 	/**
-	 * Vec3 int8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<int8_t>>
-	{
-		using Type = Vec3<int8_t>;
-		using ValueTraits = TypeTraits<int8_t>;
-		static constexpr const char RawIdentifier[] = "vec3_int8";
-		static constexpr const char Identifier[] = "%vec3_int8";
-		static constexpr const char Declaration[] = "OpTypeVector %int8 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 uint8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<uint8_t>>
-	{
-		using Type = Vec3<uint8_t>;
-		using ValueTraits = TypeTraits<uint8_t>;
-		static constexpr const char RawIdentifier[] = "vec3_uint8";
-		static constexpr const char Identifier[] = "%vec3_uint8";
-		static constexpr const char Declaration[] = "OpTypeVector %uint8 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 int16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<int16_t>>
-	{
-		using Type = Vec3<int16_t>;
-		using ValueTraits = TypeTraits<int16_t>;
-		static constexpr const char RawIdentifier[] = "vec3_int16";
-		static constexpr const char Identifier[] = "%vec3_int16";
-		static constexpr const char Declaration[] = "OpTypeVector %int16 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 uint16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<uint16_t>>
-	{
-		using Type = Vec3<uint16_t>;
-		using ValueTraits = TypeTraits<uint16_t>;
-		static constexpr const char RawIdentifier[] = "vec3_uint16";
-		static constexpr const char Identifier[] = "%vec3_uint16";
-		static constexpr const char Declaration[] = "OpTypeVector %uint16 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 int32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<int32_t>>
-	{
-		using Type = Vec3<int32_t>;
-		using ValueTraits = TypeTraits<int32_t>;
-		static constexpr const char RawIdentifier[] = "vec3_int32";
-		static constexpr const char Identifier[] = "%vec3_int32";
-		static constexpr const char Declaration[] = "OpTypeVector %int32 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 uint32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<uint32_t>>
-	{
-		using Type = Vec3<uint32_t>;
-		using ValueTraits = TypeTraits<uint32_t>;
-		static constexpr const char RawIdentifier[] = "vec3_uint32";
-		static constexpr const char Identifier[] = "%vec3_uint32";
-		static constexpr const char Declaration[] = "OpTypeVector %uint32 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 int64_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec3<int64_t>>
-	{
-		using Type = Vec3<int64_t>;
-		using ValueTraits = TypeTraits<int64_t>;
-		static constexpr const char RawIdentifier[] = "vec3_int64";
-		static constexpr const char Identifier[] = "%vec3_int64";
-		static constexpr const char Declaration[] = "OpTypeVector %int64 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
-
-	/**
-	 * Vec3 uint64_t specialization.
+	 * Vec3 type traits.
+	 *
+	 * @tparam Type The value type.
 	 */
-	template<>
-	struct TypeTraits<Vec3<uint64_t>>
-	{
-		using Type = Vec3<uint64_t>;
-		using ValueTraits = TypeTraits<uint64_t>;
-		static constexpr const char RawIdentifier[] = "vec3_uint64";
-		static constexpr const char Identifier[] = "%vec3_uint64";
-		static constexpr const char Declaration[] = "OpTypeVector %uint64 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
+	template<class Type>
+	struct TypeTraits<Vec3<Type>> : VectorTraits<Vec3<Type>, Type, 3> {};
 
 	/**
-	 * Vec3 float specialization.
+	 * Vector of specialization for 3 components.
+	 *
+	 * @tparam Value The component value type.
 	 */
-	template<>
-	struct TypeTraits<Vec3<float>>
-	{
-		using Type = Vec3<float>;
-		using ValueTraits = TypeTraits<float>;
-		static constexpr const char RawIdentifier[] = "vec3_float";
-		static constexpr const char Identifier[] = "%vec3_float";
-		static constexpr const char Declaration[] = "OpTypeVector %float 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
+	template<class Value>
+	struct VectorOf<Value, 3> { using Type = Vec3<Value>; };
 
 	/**
-	 * Vec3 double specialization.
+	 * Is complex type boolean specialization
 	 */
-	template<>
-	struct TypeTraits<Vec3<double>>
-	{
-		using Type = Vec3<double>;
-		using ValueTraits = TypeTraits<double>;
-		static constexpr const char RawIdentifier[] = "vec3_double";
-		static constexpr const char Identifier[] = "%vec3_double";
-		static constexpr const char Declaration[] = "OpTypeVector %double 3";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 3;
-	};
+	template<class Type>
+	constexpr bool IsCompexType<Vec3<Type>> = true;
 
 	/**
-	 * Is complex type boolean specialization
+	 * Is vector type boolean specialization
 	 */
 	template<class Type>
-	constexpr bool IsCompexType<Vec3<Type>> = true;
+	constexpr bool IsVectorType<Vec3<Type>> = true;
 } // namespace ShaderBuilder
\ No newline at end of file
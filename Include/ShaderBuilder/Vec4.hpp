@@ -82,27 +82,7 @@ namespace ShaderBuilder
 			if (shallow)
 				return;
 
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec4<Type>>::Identifier, other.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto wIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 3", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 4", wIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {} {} {}", compositeIdentifier, Traits::Identifier, xIdentifier, yIdentifier, zIdentifier, wIdentifier));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::copyFrom(other);
 		}
 
 		/**
@@ -114,23 +94,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, Type value) : Super(source, variableName), x(value), y(value), z(value), w(value)
 		{
-			const auto identifier = GetConstantIdentifier<uint64_t>(value);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", identifier, TypeTraits<Type>::Identifier, value));
-
-			// Setup the vector constant.
-			const Type vector[] = { value, value, value, value };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{} %{} %{}", hash, Traits::Identifier
-				, identifier
-				, identifier
-				, identifier
-				, identifier
-			));
-
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
+			Super::storeConstantComposite(value, value, value, value);
 		}
 
 		/**
@@ -145,29 +109,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, Type x, Type y, Type z, Type w) : Super(source, variableName), x(x), y(y), z(z), w(w)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-			const auto yIdentifier = GetConstantIdentifier<uint64_t>(y);
-			const auto zIdentifier = GetConstantIdentifier<uint64_t>(z);
-			const auto wIdentifier = GetConstantIdentifier<uint64_t>(w);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", yIdentifier, TypeTraits<Type>::Identifier, y));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", zIdentifier, TypeTraits<Type>::Identifier, z));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", wIdentifier, TypeTraits<Type>::Identifier, w));
-
-			// Setup the vector constant.
-			const Type vector[] = { x, y, z, w };
-			const auto hash = GenerateHash(vector, sizeof(vector));
-			source.insertType(fmt::format("%composite_{} = OpConstantComposite {} %{} %{} %{} %{}", hash, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
-
-			// Initialization happens only within function definitions, so we can simply assign it there.
-			source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpStore %{} %composite_{}", variableName, hash));
+			Super::storeConstantComposite(x, y, z, w);
 		}
 
 		/**
@@ -181,35 +123,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, const Vec2<Type>& vec, Type z, Type w) : Super(source, variableName), x(vec.x), y(vec.y), z(z), w(w)
 		{
-			const auto zIdentifier = GetConstantIdentifier<uint64_t>(z);
-			const auto wIdentifier = GetConstantIdentifier<uint64_t>(w);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", zIdentifier, TypeTraits<Type>::Identifier, z));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", wIdentifier, TypeTraits<Type>::Identifier, w));
-
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, vec.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {} %{} %{}", compositeIdentifier, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::storeComposite(fmt::format("{} {} {}", vec.getValueIdentifier(), Super::storeConstant(z), Super::storeConstant(w)));
 		}
 
 		/**
@@ -223,35 +137,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, Type x, const Vec2<Type>& vec, Type w) : Super(source, variableName), x(x), y(vec.x), z(vec.y), w(w)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-			const auto wIdentifier = GetConstantIdentifier<uint64_t>(w);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", wIdentifier, TypeTraits<Type>::Identifier, w));
-
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, vec.getName()));
-
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} %{} {} {} %{}", compositeIdentifier, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::storeComposite(fmt::format("{} {} {}", Super::storeConstant(x), vec.getValueIdentifier(), Super::storeConstant(w)));
 		}
 
 		/**
@@ -261,39 +147,24 @@ namespace ShaderBuilder
 		 * @param variableName The name of the variable.
 		 * @param x The x to initialize the x member with.
 		 * @param y The y to initialize the y member with.
-		 * @param vec The vec2 to initialize vec3.
+		 * @param vec The vec2 to initialize vec4.
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, Type x, Type y, const Vec2<Type>& vec) : Super(source, variableName), x(x), y(y), z(vec.x), w(vec.y)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
-			const auto yIdentifier = GetConstantIdentifier<uint64_t>(y);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
-			source.insertType(fmt::format("%{} = OpConstant {} {}", yIdentifier, TypeTraits<Type>::Identifier, y));
-
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec2<Type>>::Identifier, vec.getName()));
-
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto wIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", wIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} %{} %{} {} {}", compositeIdentifier, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
+			Super::storeComposite(fmt::format("{} {} {}", Super::storeConstant(x), Super::storeConstant(y), vec.getValueIdentifier()));
+		}
 
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param source The source to insert the instructions to.
+		 * @param variableName The name of the variable.
+		 * @param lhs The vec2 to initialize the x and y members with.
+		 * @param rhs The vec2 to initialize the z and w members with.
+		 */
+		explicit Vec4(SPIRVSource& source, const std::string& variableName, const Vec2<Type>& lhs, const Vec2<Type>& rhs) : Super(source, variableName), x(lhs.x), y(lhs.y), z(rhs.x), w(rhs.y)
+		{
+			Super::storeComposite(fmt::format("{} {}", lhs.getValueIdentifier(), rhs.getValueIdentifier()));
 		}
 
 		/**
@@ -306,35 +177,7 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, const Vec3<Type>& vec, Type w) : Super(source, variableName), x(vec.x), y(vec.y), z(vec.z), w(w)
 		{
-			const auto wIdentifier = GetConstantIdentifier<uint64_t>(w);
-
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", wIdentifier, TypeTraits<Type>::Identifier, w));
-
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec3<Type>>::Identifier, vec.getName()));
-
-			const auto xIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", xIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 2", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} {} {} {} %{}", compositeIdentifier, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
-
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
+			Super::storeComposite(fmt::format("{} {}", vec.getValueIdentifier(), Super::storeConstant(w)));
 		}
 
 		/**
@@ -347,36 +190,53 @@ namespace ShaderBuilder
 		 */
 		explicit Vec4(SPIRVSource& source, const std::string& variableName, Type x, const Vec3<Type>& vec) : Super(source, variableName), x(x), y(vec.x), z(vec.y), w(vec.z)
 		{
-			const auto xIdentifier = GetConstantIdentifier<uint64_t>(x);
+			Super::storeComposite(fmt::format("{} {}", Super::storeConstant(x), vec.getValueIdentifier()));
+		}
 
-			// Setup the values.
-			source.insertType(fmt::format("%{} = OpConstant {} {}", xIdentifier, TypeTraits<Type>::Identifier, x));
+		/**
+		 * Swizzle the vector.
+		 * The components can be given using any of the xyzw, rgba or stpq sets and are recorded as a single instruction.
+		 *
+		 * @tparam Components The components to select.
+		 * @return The resulting temporary.
+		 */
+		template<char... Components>
+		[[nodiscard]] auto swizzle() const { return Swizzle<Components...>(*this); }
 
-			// Load the memory.
-			auto& functionBlock = source.getCurrentFunctionBlock();
-			const auto variableIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpLoad {} %{}", variableIdentifier, TypeTraits<Vec3<Type>>::Identifier, vec.getName()));
+		/**
+		 * Get the xy swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto xy() const { return swizzle<'x', 'y'>(); }
 
-			const auto yIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto zIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
-			const auto wIdentifier = fmt::format("%{}", Super::m_Source.getUniqueIdentifier());
+		/**
+		 * Get the zw swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto zw() const { return swizzle<'z', 'w'>(); }
 
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 0", yIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 1", zIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeExtract {} {} 2", wIdentifier, TypeTraits<Type>::Identifier, variableIdentifier));
+		/**
+		 * Get the xyz swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto xyz() const { return swizzle<'x', 'y', 'z'>(); }
 
-			// Create the composite.
-			const auto compositeIdentifier = fmt::format("%{}", source.getUniqueIdentifier());
-			functionBlock.m_Instructions.insert(fmt::format("{} = OpCompositeConstruct {} %{} {} {} {}", compositeIdentifier, Traits::Identifier
-				, xIdentifier
-				, yIdentifier
-				, zIdentifier
-				, wIdentifier
-			));
+		/**
+		 * Get the rgb swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto rgb() const { return swizzle<'r', 'g', 'b'>(); }
 
-			// Store it.
-			functionBlock.m_Instructions.insert(fmt::format("OpStore %{} {}", variableName, compositeIdentifier));
-		}
+		/**
+		 * Get the zyx swizzle of the vector.
+		 *
+		 * @return The resulting temporary.
+		 */
+		[[nodiscard]] auto zyx() const { return swizzle<'z', 'y', 'x'>(); }
 
 		/**
 		 * Assignment operator.
@@ -386,7 +246,7 @@ namespace ShaderBuilder
 		 */
 		Vec4& operator=(const Vec4& other)
 		{
-			Super::m_Source.getCurrentFunctionBlock().m_Instructions.insert(fmt::format("OpCopyMemory %{} %{}", Super::m_VariableName, other.getName()));
+			Super::copyFrom(other);
 
 			x = other.x;
 			y = other.y;
@@ -405,148 +265,30 @@ namespace ShaderBuilder
 	};
 
 	/**
-	 * Vec4 int8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<int8_t>>
-	{
-		using Type = Vec4<int8_t>;
-		using ValueTraits = TypeTraits<int8_t>;
-		static constexpr const char RawIdentifier[] = "vec4_int8";
-		static constexpr const char Identifier[] = "%vec4_int8";
-		static constexpr const char Declaration[] = "OpTypeVector %int8 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 uint8_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<uint8_t>>
-	{
-		using Type = Vec4<uint8_t>;
-		using ValueTraits = TypeTraits<uint8_t>;
-		static constexpr const char RawIdentifier[] = "vec4_uint8";
-		static constexpr const char Identifier[] = "%vec4_uint8";
-		static constexpr const char Declaration[] = "OpTypeVector %uint8 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 int16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<int16_t>>
-	{
-		using Type = Vec4<int16_t>;
-		using ValueTraits = TypeTraits<int16_t>;
-		static constexpr const char RawIdentifier[] = "vec4_int16";
-		static constexpr const char Identifier[] = "%vec4_int16";
-		static constexpr const char Declaration[] = "OpTypeVector %int16 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 uint16_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<uint16_t>>
-	{
-		using Type = Vec4<uint16_t>;
-		using ValueTraits = TypeTraits<uint16_t>;
-		static constexpr const char RawIdentifier[] = "vec4_uint16";
-		static constexpr const char Identifier[] = "%vec4_uint16";
-		static constexpr const char Declaration[] = "OpTypeVector %uint16 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 int32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<int32_t>>
-	{
-		using Type = Vec4<int32_t>;
-		using ValueTraits = TypeTraits<int32_t>;
-		static constexpr const char RawIdentifier[] = "vec4_int32";
-		static constexpr const char Identifier[] = "%vec4_int32";
-		static constexpr const char Declaration[] = "OpTypeVector %int32 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 uint32_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<uint32_t>>
-	{
-		using Type = Vec4<uint32_t>;
-		using ValueTraits = TypeTraits<uint32_t>;
-		static constexpr const char RawIdentifier[] = "vec4_uint32";
-		static constexpr const char Identifier[] = "%vec4_uint32";
-		static constexpr const char Declaration[] = "OpTypeVector %uint32 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 int64_t specialization.
-	 */
-	template<>
-	struct TypeTraits<Vec4<int64_t>>
-	{
-		using Type = Vec4<int64_t>;
-		using ValueTraits = TypeTraits<int64_t>;
-		static constexpr const char RawIdentifier[] = "vec4_int64";
-		static constexpr const char Identifier[] = "%vec4_int64";
-		static constexpr const char Declaration[] = "OpTypeVector %int64 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
-
-	/**
-	 * Vec4 uint64_t specialization.
+	 * Vec4 type traits.
+	 *
+	 * @tparam Type The value type.
 	 */
-	template<>
-	struct TypeTraits<Vec4<uint64_t>>
-	{
-		using Type = Vec4<uint64_t>;
-		using ValueTraits = TypeTraits<uint64_t>;
-		static constexpr const char RawIdentifier[] = "vec4_uint64";
-		static constexpr const char Identifier[] = "%vec4_uint64";
-		static constexpr const char Declaration[] = "OpTypeVector %uint64 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
+	template<class Type>
+	struct TypeTraits<Vec4<Type>> : VectorTraits<Vec4<Type>, Type, 4> {};
 
 	/**
-	 * Vec4 float specialization.
+	 * Vector of specialization for 4 components.
+	 *
+	 * @tparam Value The component value type.
 	 */
-	template<>
-	struct TypeTraits<Vec4<float>>
-	{
-		using Type = Vec4<float>;
-		using ValueTraits = TypeTraits<float>;
-		static constexpr const char RawIdentifier[] = "vec4_float";
-		static constexpr const char Identifier[] = "%vec4_float";
-		static constexpr const char Declaration[] = "OpTypeVector %float 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
+	template<class Value>
+	struct VectorOf<Value, 4> { using Type = Vec4<Value>; };
 
 	/**
-	 * Vec4 double specialization.
+	 * Is complex type boolean specialization
 	 */
-	template<>
-	struct TypeTraits<Vec4<double>>
-	{
-		using Type = Vec4<double>;
-		using ValueTraits = TypeTraits<double>;
-		static constexpr const char RawIdentifier[] = "vec4_double";
-		static constexpr const char Identifier[] = "%vec4_double";
-		static constexpr const char Declaration[] = "OpTypeVector %double 4";
-		static constexpr uint8_t Size = sizeof(ValueTraits::Type) * 4;
-	};
+	template<class Type>
+	constexpr bool IsCompexType<Vec4<Type>> = true;
 
 	/**
-	 * Is complex type boolean specialization
+	 * Is vector type boolean specialization
 	 */
 	template<class Type>
-	constexpr bool IsCompexType<Vec4<Type>> = true;
+	constexpr bool IsVectorType<Vec4<Type>> = true;
 } // namespace ShaderBuilder
\ No newline at end of file
@@ -11,27 +11,33 @@ namespace ShaderBuilder
 	/**
 	 * Vertex function builder class.
 	 * This contains the vertex shader specific code that can be accessed by a vertex shader.
+	 * The built-in variables are declared on their first use, so only the used ones end up in the entry point's interface.
 	 */
 	class VertexFunctionBuilder final : public FunctionBuilder
 	{
-		/**
-		 * Built in structure.
-		 */
-		struct BuiltIn final : public DataType<BuiltIn>
-		{
-			Vec4<float> m_Position;
-			float m_PointSize;
-			std::array<float, 1> m_ClipDistance;
-			std::array<float, 1> m_CullDistance;
-		};
-
 	public:
 		/**
 		 * Explicit constructor.
 		 *
 		 * @param source The SPIRV source.
 		 */
-		explicit VertexFunctionBuilder(SPIRVSource& source);
+		explicit VertexFunctionBuilder(SPIRVSource& source) : FunctionBuilder(source) {}
+
+		/**
+		 * Get the index of the vertex.
+		 * This includes the first vertex (or the vertex offset of an indexed draw), unlike gl_VertexID in OpenGL.
+		 *
+		 * @return The vertex index.
+		 */
+		[[nodiscard]] Scalar<int32_t> getVertexIndex() { return getBuiltIn<Scalar<int32_t>>("VertexIndex"); }
+
+		/**
+		 * Get the index of the instance.
+		 * This includes the first instance, unlike gl_InstanceID in OpenGL.
+		 *
+		 * @return The instance index.
+		 */
+		[[nodiscard]] Scalar<int32_t> getInstanceIndex() { return getBuiltIn<Scalar<int32_t>>("InstanceIndex"); }
 
 		/**
 		 * Set the position value.
@@ -39,6 +45,13 @@ namespace ShaderBuilder
 		 * @param value The value to set.
 		 */
 		void setPoisition(const Vec4<float>& value);
+
+		/**
+		 * Set the size of the point when rasterizing points.
+		 *
+		 * @param size The size in pixels.
+		 */
+		void setPointSize(const Scalar<float>& size);
 	};
 
 	/**
@@ -49,9 +62,11 @@ namespace ShaderBuilder
 	{
 	public:
 		/**
-		 * Default constructor.
+		 * Explicit constructor.
+		 *
+		 * @param config The builder's initial configuration.
 		 */
-		VertexBuilder() = default;
+		explicit VertexBuilder(Configuration config = Configuration()) : Builder(config) {}
 
 		/**
 		 * Create a new function.
@@ -60,29 +75,30 @@ namespace ShaderBuilder
 		 *
 		 * @tparam Lambda The lambda type.
 		 * @param function The function definition. Make sure that the function's first parameter/ argument is FunctionBuilder&.
+		 * @param control The function control flags. Default is None.
 		 * @return The function.
 		 */
 		template<class Lambda>
-		[[nodiscard]] decltype(auto) createFunction(Lambda&& function) { return Function(m_Source, std::function(std::move(function))); }
+		[[nodiscard]] decltype(auto) createFunction(Lambda&& function, FunctionControl control = FunctionControl::None) { return Function<std::decay_t<Lambda>>(m_Source, std::forward<Lambda>(function), control); }
 
 		/**
 		 * Add an entry point to the shader.
-		 * Note that this will run the entry point function once for convenience.
+		 * Note that this will record the entry point function if it hasn't been recorded already.
 		 *
 		 * @tparam FunctionType The function type.
 		 * @tparam Attributes The input and output attribute types.
 		 * @param function The entry point function. Make sure that the return type is void and there are no parameters.
-		 * @param attributes The names of the input and output attributes.
+		 * @param attributes The input and output attributes. The used built-ins are added automatically.
 		 */
 		template<class FunctionType, class... Attributes>
 		void addEntryPoint(FunctionType& function, const Attributes&... attributes)
 		{
-			// Validate the entry point and run it once.
+			// Validate the entry point and record it.
 			if constexpr (FunctionType::ParameterCount > 0 || !std::is_void_v<typename FunctionType::ReturnType>)
 				throw BuilderError("Entry points should not have any parameters and the return type should be void!");
 
 			else
-				function();
+				function.record();
 
 			// Setup the inputs.
 			std::string attributeString;
@@ -90,7 +106,26 @@ namespace ShaderBuilder
 			(insertAttribute(attributes), ...);
 
 			const auto& name = function.getName();
-			m_Source.insertEntryPoint(fmt::format("OpEntryPoint Vertex %{} \"{}\" %perVertex {}", name, name, attributeString));
+			m_Source.insertEntryPoint(fmt::format("OpEntryPoint Vertex %{} \"{}\"{}{}", name, name, attributeString, m_Source.getInterfaceVariables()));
 		}
+
+		/**
+		 * Create the depth-only variant of the shader, which is used by the shadow and depth pre-passes.
+		 * The variant only keeps the instructions which compute the position. The other outputs are removed, and so are the inputs and the uniforms
+		 * which are no longer used. The point size is kept, as it changes which pixels a point covers.
+		 * Make sure that the entry point is added before creating the variant.
+		 *
+		 * @return The variant's builder.
+		 * @throws BuilderError If the shader does not set the position.
+		 */
+		[[nodiscard]] VertexBuilder createDepthOnlyVariant() const;
+
+		/**
+		 * Compile the shader and its depth-only variant (see createDepthOnlyVariant()).
+		 *
+		 * @param flags Optimization flags. Default is Release.
+		 * @return The compiled shader and the compiled depth-only variant, in that order.
+		 */
+		[[nodiscard]] std::pair<SPIRVBinary, SPIRVBinary> compileWithDepthOnlyVariant(OptimizationFlags flags = OptimizationFlags::Release) const;
 	};
 } // namespace ShaderBuilder
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <spirv-tools/libspirv.hpp>
 #include <spirv-tools/optimizer.hpp>
+#include <spirv-tools/linker.hpp>
 
 #include <fmt/color.h>
 
@@ -55,16 +56,172 @@ namespace /* anonymous */
 namespace ShaderBuilder
 {
 	Builder::Builder(Configuration config /*= Configuration()*/)
+		: m_Configuration(config)
 	{
 		m_Source.insertCapability("OpCapability Shader");
 		m_Source.insertExtendedInstructionSet("%glsl = OpExtInstImport \"GLSL.std.450\"");
 		m_Source.setMemoryModel(fmt::format("OpMemoryModel {} {}", GetAddressingModel(config.m_AddressingModel), GetMemoryModel(config.m_MemoryModel)));
+		m_Source.setInlineThreshold(config.m_InlineThreshold);
+		m_Source.setDefaultPrecisionPolicy(config.m_PrecisionPolicy);
 	}
 
 	Builder::~Builder()
 	{
 	}
 
+	void Builder::insertBlock(const std::string& identifier, const char* storageClass, BlockLayout&& layout, std::optional<uint32_t> descriptorCount /*= std::nullopt*/)
+	{
+		const auto members = layout.getOrderedMembers();
+
+		// The stride is decorated on the array type, so a type can only have a single stride.
+		for (const auto& member : members)
+		{
+			if (const auto stride = m_ArrayStrides.find(member.m_TypeIdentifier); member.m_ArrayStride > 0 && stride != m_ArrayStrides.end() && stride->second != member.m_ArrayStride)
+				throw BuilderError(fmt::format("The array type {} is used with the strides {} and {}! Use the same layout rule for all the blocks containing it.", member.m_TypeIdentifier, stride->second, member.m_ArrayStride));
+		}
+
+		// Setup type declarations.
+		std::string memberTypes;
+		for (const auto& member : members)
+			memberTypes += fmt::format(" {}", member.m_TypeIdentifier);
+
+		m_Source.insertType(fmt::format("%type_{} = OpTypeStruct{}", identifier, memberTypes));
+
+		// Descriptor arrays wrap the block in an array. Arrays of blocks must not have an array stride.
+		if (descriptorCount)
+		{
+			if (*descriptorCount == 0)
+			{
+				m_Source.insertType(fmt::format("%array_type_{} = OpTypeRuntimeArray %type_{}", identifier, identifier));
+				m_Source.insertCapability("OpCapability RuntimeDescriptorArray");
+				m_Source.insertExtension("OpExtension \"SPV_EXT_descriptor_indexing\"");
+			}
+			else
+			{
+				m_Source.storeConstant(*descriptorCount);
+				m_Source.insertType(fmt::format("%array_type_{} = OpTypeArray %type_{} %{}", identifier, identifier, GetConstantIdentifier(*descriptorCount)));
+			}
+
+			m_Source.insertType(fmt::format("%pointer_type_{} = OpTypePointer {} %array_type_{}", identifier, storageClass, identifier));
+		}
+		else
+			m_Source.insertType(fmt::format("%pointer_type_{} = OpTypePointer {} %type_{}", identifier, storageClass, identifier));
+
+		m_Source.insertType(fmt::format("%{} = OpVariable %pointer_type_{} {}", identifier, identifier, storageClass));
+		m_Source.insertInterfaceVariable(identifier);
+
+		// Set the type debug information and annotations.
+		m_Source.insertName(fmt::format("OpName %type_{} \"type_{}\"", identifier, identifier));
+		m_Source.insertName(fmt::format("OpName %{} \"\"", identifier));
+		m_Source.insertAnnotation(fmt::format("OpDecorate %type_{} Block", identifier));
+
+		for (const auto& member : members)
+		{
+			m_Source.insertName(fmt::format("OpMemberName %type_{} {} \"{}\"", identifier, member.m_Index, member.m_Name));
+			m_Source.insertAnnotation(fmt::format("OpMemberDecorate %type_{} {} Offset {}", identifier, member.m_Index, member.m_Offset));
+
+			// Matrices also need to know how the columns are laid out.
+			if (member.m_MatrixStride > 0)
+			{
+				m_Source.insertAnnotation(fmt::format("OpMemberDecorate %type_{} {} ColMajor", identifier, member.m_Index));
+				m_Source.insertAnnotation(fmt::format("OpMemberDecorate %type_{} {} MatrixStride {}", identifier, member.m_Index, member.m_MatrixStride));
+			}
+
+			// The stride is decorated on the array type, so make sure to do it only once per type.
+			if (member.m_ArrayStride > 0 && m_ArrayStrides.try_emplace(member.m_TypeIdentifier, member.m_ArrayStride).second)
+				m_Source.insertAnnotation(fmt::format("OpDecorate {} ArrayStride {}", member.m_TypeIdentifier, member.m_ArrayStride));
+		}
+
+		m_BlockLayouts[identifier] = std::move(layout);
+	}
+
+	void Builder::insertDescriptorBinding(const std::string& identifier, uint32_t set, uint32_t binding)
+	{
+		m_Source.insertAnnotation(fmt::format("OpDecorate %{} DescriptorSet {}", identifier, set));
+		m_Source.insertAnnotation(fmt::format("OpDecorate %{} Binding {}", identifier, binding));
+	}
+
+	void Builder::insertMemoryAccess(const std::string& identifier, MemoryAccess access)
+	{
+		if (access & MemoryAccess::NonWritable)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} NonWritable", identifier));
+
+		if (access & MemoryAccess::NonReadable)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} NonReadable", identifier));
+
+		if (access & MemoryAccess::Restrict)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Restrict", identifier));
+
+		if (access & MemoryAccess::Coherent)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Coherent", identifier));
+	}
+
+	void Builder::insertPushConstant(const std::string& identifier, BlockLayout&& layout)
+	{
+		if (!m_PushConstantBlock.empty())
+			throw BuilderError("A shader can only have one push constant block!");
+
+		if (layout.getSize() > m_Configuration.m_PushConstantBudget)
+		{
+			fmt::print(fg(fmt::color::yellow), "The push constant block is {} bytes, which exceeds the budget of {} bytes.\n", layout.getSize(), m_Configuration.m_PushConstantBudget);
+			fmt::print(fg(fmt::color::yellow), "{}", layout.getReport());
+		}
+
+		m_PushConstantBlock = identifier;
+		insertBlock(identifier, "PushConstant", std::move(layout));
+	}
+
+	bool Builder::shouldPromoteToPushConstant(const std::string& identifier, const BlockLayout& layout) const
+	{
+		if (m_Configuration.m_PushConstantPolicy == PushConstantPolicy::None || !m_PushConstantBlock.empty())
+			return false;
+
+		// The std430 layout is never larger than std140, so this is a safe check.
+		if (layout.getSize() > m_Configuration.m_PushConstantBudget)
+			return false;
+
+		if (m_Configuration.m_PushConstantPolicy == PushConstantPolicy::Suggest)
+		{
+			fmt::print(fg(fmt::color::yellow), "The uniform {} is {} bytes and fits in the push constant budget of {} bytes. Consider using createPushConstant() instead.\n", identifier, layout.getSize(), m_Configuration.m_PushConstantBudget);
+			return false;
+		}
+
+		return true;
+	}
+
+	void Builder::linkLibrary(const SPIRVBinary& library)
+	{
+		m_Libraries.emplace_back(library);
+	}
+
+	void Builder::linkNextStage(Builder& nextStage)
+	{
+		nextStage.m_Source.removeUnusedVariables();
+
+		const auto& inputs = nextStage.m_Source.getInputAttributes();
+		const auto& outputs = m_Source.getOutputAttributes();
+		for (const auto& input : inputs)
+		{
+			const auto output = std::find_if(outputs.begin(), outputs.end(), [&input](const InterfaceAttribute& output) { return output.m_Location == input.m_Location; });
+			if (output == outputs.end())
+				throw BuilderError(fmt::format("The input at location {} is not written by the previous stage!", input.m_Location));
+
+			if (output->m_TypeIdentifier != input.m_TypeIdentifier)
+				throw BuilderError(fmt::format("The output at location {} is {}, but the next stage reads it as {}!", input.m_Location, output->m_TypeIdentifier, input.m_TypeIdentifier));
+		}
+
+		// Remove the outputs which the next stage does not read.
+		std::vector<std::string> unusedOutputs;
+		for (const auto& output : outputs)
+		{
+			if (std::none_of(inputs.begin(), inputs.end(), [&output](const InterfaceAttribute& input) { return input.m_Location == output.m_Location; }))
+				unusedOutputs.emplace_back(output.m_Identifier);
+		}
+
+		if (!unusedOutputs.empty())
+			m_Source.removeOutputs(unusedOutputs);
+	}
+
 	std::string Builder::getString() const
 	{
 		return m_Source.getSourceAssembly();
@@ -133,6 +290,23 @@ namespace ShaderBuilder
 		if (!tools.Assemble(shaderCode, &spirv))
 			throw BuilderError("Failed the assemble the assembly!");
 
+		// Link the libraries if we have any.
+		if (!m_Libraries.empty())
+		{
+			auto context = spvtools::Context(SPV_ENV_UNIVERSAL_1_6);
+			context.SetMessageConsumer(errorMessageConsumer);
+
+			std::vector<std::vector<uint32_t>> binaries;
+			binaries.reserve(m_Libraries.size() + 1);
+			binaries.emplace_back(std::move(spirv));
+
+			for (const auto& library : m_Libraries)
+				binaries.emplace_back(library.getBinary());
+
+			if (spvtools::Link(context, binaries, &spirv) != SPV_SUCCESS)
+				throw BuilderError("Failed to link the libraries!");
+		}
+
 		if (!tools.Validate(spirv))
 			throw BuilderError("The generated SPIR-V is invalid!");
 
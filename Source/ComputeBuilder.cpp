@@ -0,0 +1,41 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#include "ShaderBuilder/ComputeBuilder.hpp"
+
+namespace ShaderBuilder
+{
+	void ComputeBuilder::setLocalSize(uint32_t x, uint32_t y /*= 1*/, uint32_t z /*= 1*/)
+	{
+		if (x == 0 || y == 0 || z == 0)
+			throw BuilderError("The local size cannot be zero!");
+
+		m_LocalSize = { x, y, z };
+	}
+
+	void ComputeBuilder::setLocalSizeSpecializationIds(uint32_t x, uint32_t y, uint32_t z)
+	{
+		m_LocalSizeSpecializationIds = { x, y, z };
+		m_IsLocalSizeSpecializable = true;
+	}
+
+	void ComputeBuilder::insertExecutionModes(const std::string& name)
+	{
+		m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} LocalSize {} {} {}", name, m_LocalSize[0], m_LocalSize[1], m_LocalSize[2]));
+
+		// The WorkgroupSize built-in overrides the local size, so the specialization constants take effect.
+		if (m_IsLocalSizeSpecializable)
+		{
+			m_Source.registerType<Vec3<uint32_t>>();
+
+			constexpr std::array<char, 3> dimensions = { 'x', 'y', 'z' };
+			for (uint8_t i = 0; i < dimensions.size(); i++)
+			{
+				m_Source.insertType(fmt::format("%local_size_{} = OpSpecConstant {} {}", dimensions[i], TypeTraits<uint32_t>::Identifier, m_LocalSize[i]));
+				m_Source.insertAnnotation(fmt::format("OpDecorate %local_size_{} SpecId {}", dimensions[i], m_LocalSizeSpecializationIds[i]));
+			}
+
+			m_Source.insertType(fmt::format("%gl_WorkGroupSize = OpSpecConstantComposite {} %local_size_x %local_size_y %local_size_z", TypeTraits<Vec3<uint32_t>>::Identifier));
+			m_Source.insertAnnotation("OpDecorate %gl_WorkGroupSize BuiltIn WorkgroupSize");
+		}
+	}
+} // namespace ShaderBuilder
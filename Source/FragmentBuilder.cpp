@@ -0,0 +1,78 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#include "ShaderBuilder/FragmentBuilder.hpp"
+
+namespace ShaderBuilder
+{
+	void FragmentFunctionBuilder::setDepth(const Scalar<float>& depth)
+	{
+		if (m_IsRecording)
+		{
+			auto fragDepth = getBuiltIn<Scalar<float>>("FragDepth", "Output");
+			fragDepth = depth;
+		}
+	}
+
+	void FragmentFunctionBuilder::discard()
+	{
+		if (m_IsRecording)
+		{
+			m_Source.insertExtension("OpExtension \"SPV_KHR_terminate_invocation\"");
+			m_Source.insertInstruction("OpTerminateInvocation");
+
+			// The terminator ends the block, so anything recorded after it goes to a new (unreachable) block.
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", m_Source.getUniqueIdentifier()));
+		}
+	}
+
+	void FragmentBuilder::insertInterpolation(const std::string& identifier, Interpolation interpolation)
+	{
+		if (interpolation & Interpolation::Flat)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Flat", identifier));
+
+		if (interpolation & Interpolation::NoPerspective)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} NoPerspective", identifier));
+
+		if (interpolation & Interpolation::Centroid)
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Centroid", identifier));
+
+		if (interpolation & Interpolation::Sample)
+		{
+			m_Source.insertCapability("OpCapability SampleRateShading");
+			m_Source.insertAnnotation(fmt::format("OpDecorate %{} Sample", identifier));
+		}
+	}
+
+	void FragmentBuilder::insertExecutionModes(const std::string& name)
+	{
+		// Vulkan always uses the upper left origin.
+		m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} OriginUpperLeft", name));
+
+		if (m_EarlyFragmentTests)
+			m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} EarlyFragmentTests", name));
+
+		// The depth modes are only valid if the shader writes the depth.
+		if (m_Source.isInterfaceVariable("gl_FragDepth"))
+		{
+			m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} DepthReplacing", name));
+
+			switch (m_DepthMode)
+			{
+			case DepthMode::Greater:
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} DepthGreater", name));
+				break;
+
+			case DepthMode::Less:
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} DepthLess", name));
+				break;
+
+			case DepthMode::Unchanged:
+				m_Source.insertExecutionMode(fmt::format("OpExecutionMode %{} DepthUnchanged", name));
+				break;
+
+			default:
+				break;
+			}
+		}
+	}
+} // namespace ShaderBuilder
@@ -1,16 +1,98 @@
 // Copyright (c) 2022 Dhiraj Wishal
 
 #include "ShaderBuilder/FunctionBuilder.hpp"
+#include "ShaderBuilder/BuilderError.hpp"
 
 namespace ShaderBuilder
 {
+	std::string GetFunctionControlString(FunctionControl control)
+	{
+		std::string controlString;
+		auto insertControl = [&controlString, control](FunctionControl flag, const char* name)
+		{
+			if (control & flag)
+				controlString += controlString.empty() ? name : fmt::format("|{}", name);
+		};
+
+		insertControl(FunctionControl::Inline, "Inline");
+		insertControl(FunctionControl::DontInline, "DontInline");
+		insertControl(FunctionControl::Pure, "Pure");
+		insertControl(FunctionControl::Const, "Const");
+
+		return controlString.empty() ? "None" : controlString;
+	}
+
+	std::string GetSelectionControlString(SelectionControl control)
+	{
+		if (control & SelectionControl::Flatten && control & SelectionControl::DontFlatten)
+			throw BuilderError("A selection cannot be both Flatten and DontFlatten!");
+
+		if (control & SelectionControl::Flatten)
+			return "Flatten";
+
+		if (control & SelectionControl::DontFlatten)
+			return "DontFlatten";
+
+		return "None";
+	}
+
+	std::string GetLoopControlString(LoopControl control, uint32_t maxIterations)
+	{
+		if (control & LoopControl::Unroll && control & LoopControl::DontUnroll)
+			throw BuilderError("A loop cannot be both Unroll and DontUnroll!");
+
+		if (control & LoopControl::MaxIterations && maxIterations == 0)
+			throw BuilderError("The MaxIterations loop control requires the maximum number of iterations!");
+
+		std::string controlString;
+		auto insertControl = [&controlString, control](LoopControl flag, const char* name)
+		{
+			if (control & flag)
+				controlString += controlString.empty() ? name : fmt::format("|{}", name);
+		};
+
+		insertControl(LoopControl::Unroll, "Unroll");
+		insertControl(LoopControl::DontUnroll, "DontUnroll");
+		insertControl(LoopControl::DependencyInfinite, "DependencyInfinite");
+		insertControl(LoopControl::MaxIterations, "MaxIterations");
+
+		// Literal operands follow the mask, in the order of the flags.
+		if (control & LoopControl::MaxIterations)
+			controlString += fmt::format(" {}", maxIterations);
+
+		return controlString.empty() ? "None" : controlString;
+	}
+
+	MemorySemantics GetUnequalSemantics(MemorySemantics semantics)
+	{
+		using Underlying = std::underlying_type_t<MemorySemantics>;
+		constexpr auto orderings = static_cast<Underlying>(MemorySemantics::Release) | static_cast<Underlying>(MemorySemantics::AcquireRelease);
+
+		auto unequal = static_cast<MemorySemantics>(static_cast<Underlying>(semantics) & ~orderings);
+		if (semantics & (MemorySemantics::Release | MemorySemantics::AcquireRelease))
+			unequal = unequal | MemorySemantics::Acquire;
+
+		return unequal;
+	}
+
 	FunctionBuilder::~FunctionBuilder()
 	{
 		if (!m_IsComplete)
-			exit();
+			finish();
 	}
 
 	void FunctionBuilder::exit()
+	{
+		if (m_IsRecording)
+		{
+			m_Source.insertInstruction("OpReturn");
+
+			// The terminator ends the block, so anything recorded after it goes to a new (unreachable) block.
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", m_Source.getUniqueIdentifier()));
+		}
+	}
+
+	void FunctionBuilder::finish()
 	{
 		if (m_IsRecording)
 		{
@@ -21,6 +103,48 @@ namespace ShaderBuilder
 		}
 	}
 
+	void FunctionBuilder::controlBarrier(Scope execution, Scope memory, MemorySemantics semantics)
+	{
+		m_Source.insertInstruction(fmt::format("OpControlBarrier {} {} {}", storeScope(execution), storeScope(memory), storeMemorySemantics(semantics)));
+	}
+
+	void FunctionBuilder::memoryBarrier(Scope memory, MemorySemantics semantics)
+	{
+		m_Source.insertInstruction(fmt::format("OpMemoryBarrier {} {}", storeScope(memory), storeMemorySemantics(semantics)));
+	}
+
+	std::string FunctionBuilder::getAtomicSemantics(MemorySemantics semantics, const char* storageClass)
+	{
+		const auto storage = std::string_view(storageClass);
+		const auto isWorkgroup = storage == "Workgroup";
+		if (!isWorkgroup && storage != "StorageBuffer" && storage != "PhysicalStorageBuffer")
+			throw BuilderError(fmt::format("Atomic operations are not supported on the {} storage class!", storageClass));
+
+		// Orderings need the memory they apply to.
+		constexpr auto orderings = MemorySemantics::Acquire | MemorySemantics::Release | MemorySemantics::AcquireRelease | MemorySemantics::SequentiallyConsistent;
+		constexpr auto storageClasses = MemorySemantics::UniformMemory | MemorySemantics::WorkgroupMemory | MemorySemantics::ImageMemory;
+		if ((semantics & orderings) && !(semantics & storageClasses))
+			semantics = semantics | (isWorkgroup ? MemorySemantics::WorkgroupMemory : MemorySemantics::UniformMemory);
+
+		return storeMemorySemantics(semantics);
+	}
+
+	std::string FunctionBuilder::storeScope(Scope scope)
+	{
+		const auto value = static_cast<uint32_t>(scope);
+		m_Source.storeConstant(value);
+
+		return "%" + GetConstantIdentifier(value);
+	}
+
+	std::string FunctionBuilder::storeMemorySemantics(MemorySemantics semantics)
+	{
+		const auto value = static_cast<uint32_t>(semantics);
+		m_Source.storeConstant(value);
+
+		return "%" + GetConstantIdentifier(value);
+	}
+
 	void FunctionBuilder::toggleRecording()
 	{
 		if (m_IsRecording)
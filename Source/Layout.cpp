@@ -0,0 +1,195 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#include "ShaderBuilder/Layout.hpp"
+#include "ShaderBuilder/BuilderError.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the alignment of the whole block.
+	 *
+	 * @param members The members of the block.
+	 * @param rule The layout rule.
+	 * @return The alignment.
+	 */
+	uint32_t GetBlockAlignment(const std::vector<ShaderBuilder::MemberLayout>& members, ShaderBuilder::LayoutRule rule)
+	{
+		uint32_t alignment = 1;
+		for (const auto& member : members)
+			alignment = std::max(alignment, member.m_Alignment);
+
+		// Structures are rounded up to the alignment of a vec4 when using std140.
+		if (rule == ShaderBuilder::LayoutRule::Std140)
+			alignment = ShaderBuilder::AlignOffset(alignment, 16);
+
+		return alignment;
+	}
+
+	/**
+	 * Place the members one after the other in the given order.
+	 *
+	 * @param members The members to place. The offsets and indexes are updated.
+	 * @param order The member indexes in the order they should be placed.
+	 * @param alignment The alignment of the block.
+	 * @return The size of the block.
+	 */
+	uint32_t PlaceMembers(std::vector<ShaderBuilder::MemberLayout>& members, const std::vector<size_t>& order, uint32_t alignment)
+	{
+		uint32_t offset = 0, index = 0;
+		for (const auto member : order)
+		{
+			auto& layout = members[member];
+			layout.m_Index = index++;
+			layout.m_Offset = ShaderBuilder::AlignOffset(offset, layout.m_Alignment);
+			offset = layout.m_Offset + layout.m_Size;
+		}
+
+		return ShaderBuilder::AlignOffset(offset, alignment);
+	}
+
+	/**
+	 * Find the order of the members which uses the least amount of padding.
+	 * At every offset, the member which needs the least padding is placed first. Ties are resolved by placing the member with
+	 * the larger alignment first, which fills the gaps after three component vectors with scalars.
+	 *
+	 * @param members The members of the block.
+	 * @return The member order.
+	 */
+	std::vector<size_t> FindCompactOrder(const std::vector<ShaderBuilder::MemberLayout>& members)
+	{
+		std::vector<size_t> remaining;
+		remaining.reserve(members.size());
+
+		// Runtime arrays should stay at the end.
+		for (size_t i = 0; i < members.size(); i++)
+		{
+			if (!members[i].m_IsRuntimeArray)
+				remaining.emplace_back(i);
+		}
+
+		std::vector<size_t> order;
+		order.reserve(members.size());
+
+		uint32_t offset = 0;
+		while (!remaining.empty())
+		{
+			auto best = remaining.begin();
+			auto bestPadding = ShaderBuilder::AlignOffset(offset, members[*best].m_Alignment) - offset;
+
+			for (auto itr = std::next(remaining.begin()); itr != remaining.end(); ++itr)
+			{
+				const auto& candidate = members[*itr];
+				const auto padding = ShaderBuilder::AlignOffset(offset, candidate.m_Alignment) - offset;
+
+				if (padding < bestPadding || (padding == bestPadding && candidate.m_Alignment > members[*best].m_Alignment))
+				{
+					best = itr;
+					bestPadding = padding;
+				}
+			}
+
+			const auto& layout = members[*best];
+			offset = ShaderBuilder::AlignOffset(offset, layout.m_Alignment) + layout.m_Size;
+
+			order.emplace_back(*best);
+			remaining.erase(best);
+		}
+
+		for (size_t i = 0; i < members.size(); i++)
+		{
+			if (members[i].m_IsRuntimeArray)
+				order.emplace_back(i);
+		}
+
+		return order;
+	}
+
+	/**
+	 * Get the layout rule's name.
+	 *
+	 * @param rule The layout rule.
+	 * @return The name string.
+	 */
+	const char* GetLayoutRuleName(ShaderBuilder::LayoutRule rule)
+	{
+		switch (rule)
+		{
+		case ShaderBuilder::LayoutRule::Std140:									return "std140";
+		case ShaderBuilder::LayoutRule::Std430:									return "std430";
+		default:																throw ShaderBuilder::BuilderError("Invalid layout rule!");
+		}
+	}
+}
+
+namespace ShaderBuilder
+{
+	BlockLayout::BlockLayout(std::vector<MemberLayout>&& members, LayoutRule rule, bool optimize)
+		: m_Members(std::move(members)), m_Rule(rule)
+	{
+		// Runtime arrays can only be the last member of a block.
+		for (size_t i = 0; i + 1 < m_Members.size(); i++)
+		{
+			if (m_Members[i].m_IsRuntimeArray)
+				throw BuilderError(fmt::format("The runtime array {} must be the last member of the block!", m_Members[i].m_Name));
+		}
+
+		const auto alignment = GetBlockAlignment(m_Members, rule);
+
+		std::vector<size_t> declaredOrder(m_Members.size());
+		for (size_t i = 0; i < declaredOrder.size(); i++)
+			declaredOrder[i] = i;
+
+		m_PaddedSize = PlaceMembers(m_Members, declaredOrder, alignment);
+		m_Size = m_PaddedSize;
+
+		// Try to find a better order and use it only if it's actually smaller.
+		if (optimize)
+		{
+			auto compactMembers = m_Members;
+			const auto compactSize = PlaceMembers(compactMembers, FindCompactOrder(compactMembers), alignment);
+
+			if (compactSize < m_PaddedSize)
+			{
+				m_Members = std::move(compactMembers);
+				m_Size = compactSize;
+			}
+		}
+	}
+
+	const MemberLayout& BlockLayout::getMember(const std::string& name) const
+	{
+		const auto itr = std::find_if(m_Members.begin(), m_Members.end(), [&name](const MemberLayout& member) { return member.m_Name == name; });
+		if (itr == m_Members.end())
+			throw BuilderError(fmt::format("The member {} is not in the block!", name));
+
+		return *itr;
+	}
+
+	std::vector<MemberLayout> BlockLayout::getOrderedMembers() const
+	{
+		auto members = m_Members;
+		std::sort(members.begin(), members.end(), [](const MemberLayout& lhs, const MemberLayout& rhs) { return lhs.m_Index < rhs.m_Index; });
+
+		return members;
+	}
+
+	std::string BlockLayout::getReport() const
+	{
+		auto report = fmt::format("Block layout ({}):\n", GetLayoutRuleName(m_Rule));
+		for (const auto& member : getOrderedMembers())
+		{
+			if (member.m_IsRuntimeArray)
+				report += fmt::format("\t[{}] {}: offset {}, runtime array with stride {}, alignment {}\n", member.m_Index, member.m_Name, member.m_Offset, member.m_ArrayStride, member.m_Alignment);
+
+			else
+				report += fmt::format("\t[{}] {}: offset {}, size {}, alignment {}\n", member.m_Index, member.m_Name, member.m_Offset, member.m_Size, member.m_Alignment);
+		}
+
+		report += fmt::format("Padded size: {} bytes, final size: {} bytes, saved: {} bytes.\n", m_PaddedSize, m_Size, m_PaddedSize - m_Size);
+		return report;
+	}
+} // namespace ShaderBuilder
@@ -0,0 +1,37 @@
+// Copyright (c) 2022 Dhiraj Wishal
+
+#include "ShaderBuilder/MeshBuilder.hpp"
+
+namespace ShaderBuilder
+{
+	void TaskFunctionBuilder::recordEmitMeshTasks(const Scalar<uint32_t>& x, const Scalar<uint32_t>& y, const Scalar<uint32_t>& z, const std::string& payload)
+	{
+		if (m_IsRecording)
+		{
+			const auto xIdentifier = x.getValueIdentifier();
+			const auto yIdentifier = y.getValueIdentifier();
+			const auto zIdentifier = z.getValueIdentifier();
+			m_Source.insertInstruction(fmt::format("OpEmitMeshTasksEXT {} {} {}{}", xIdentifier, yIdentifier, zIdentifier, payload));
+
+			// The terminator ends the block, so anything recorded after it goes to a new (unreachable) block.
+			m_Source.insertInstruction(fmt::format("%{} = OpLabel", m_Source.getUniqueIdentifier()));
+		}
+	}
+
+	void MeshFunctionBuilder::setMeshOutputs(const Scalar<uint32_t>& vertexCount, const Scalar<uint32_t>& primitiveCount)
+	{
+		if (m_IsRecording)
+		{
+			const auto vertexCountIdentifier = vertexCount.getValueIdentifier();
+			const auto primitiveCountIdentifier = primitiveCount.getValueIdentifier();
+			m_Source.insertInstruction(fmt::format("OpSetMeshOutputsEXT {} {}", vertexCountIdentifier, primitiveCountIdentifier));
+		}
+	}
+
+	TaskBuilder::TaskBuilder(Configuration config /*= Configuration()*/)
+		: ComputeBuilder(config, "TaskEXT")
+	{
+		m_Source.insertCapability("OpCapability MeshShadingEXT");
+		m_Source.insertExtension("OpExtension \"SPV_EXT_mesh_shader\"");
+	}
+} // namespace ShaderBuilder
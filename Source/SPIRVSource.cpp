@@ -1,11 +1,276 @@
 // Copyright (c) 2022 Dhiraj Wishal
 
 #include "ShaderBuilder/SPIRVSource.hpp"
+#include "ShaderBuilder/BuilderError.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace /* anonymous */
+{
+	/**
+	 * Check if an instruction starts or ends a block.
+	 * Functions containing these cannot be inlined as a single block.
+	 *
+	 * @param instruction The instruction to check.
+	 * @return True if the instruction is a control flow instruction.
+	 * @return False if the instruction is not a control flow instruction.
+	 */
+	bool IsControlFlowInstruction(const std::string& instruction)
+	{
+		constexpr const char* controlFlowInstructions[] = { "OpLabel", "OpBranch", "OpSwitch", "OpSelectionMerge", "OpLoopMerge", "OpReturn", "OpKill", "OpTerminateInvocation", "OpUnreachable" };
+		return std::any_of(std::begin(controlFlowInstructions), std::end(controlFlowInstructions), [&instruction](const char* name) { return instruction.find(name) != std::string::npos; });
+	}
+
+	/**
+	 * Check if an instruction is a floating point arithmetic instruction.
+	 * NoContraction and FPFastMathMode can only be applied to the results of these.
+	 *
+	 * @param instruction The instruction name.
+	 * @return True if the instruction is a floating point arithmetic instruction.
+	 * @return False if the instruction is not a floating point arithmetic instruction.
+	 */
+	bool IsFloatArithmeticInstruction(std::string_view instruction)
+	{
+		constexpr std::string_view arithmeticInstructions[] = { "OpFAdd", "OpFSub", "OpFMul", "OpFDiv", "OpFRem", "OpFMod", "OpFNegate", "OpVectorTimesScalar", "OpMatrixTimesScalar", "OpVectorTimesMatrix", "OpMatrixTimesVector", "OpMatrixTimesMatrix", "OpDot" };
+		return std::find(std::begin(arithmeticInstructions), std::end(arithmeticInstructions), instruction) != std::end(arithmeticInstructions);
+	}
+
+	/**
+	 * Scalar width flags.
+	 * These mark the scalar types which need their own capabilities.
+	 */
+	constexpr uint8_t Integer8 = 1 << 0;
+	constexpr uint8_t Integer16 = 1 << 1;
+	constexpr uint8_t Integer64 = 1 << 2;
+	constexpr uint8_t Float16 = 1 << 3;
+	constexpr uint8_t Float64 = 1 << 4;
+
+	// The 8 and 16 bit types can be used without their arithmetic capabilities if they're only stored and loaded.
+	constexpr uint8_t StorableWidths = Integer8 | Integer16 | Float16;
+
+	/**
+	 * Split an instruction into its words.
+	 *
+	 * @param instruction The instruction.
+	 * @return The words of the instruction.
+	 */
+	std::vector<std::string> SplitInstruction(const std::string& instruction)
+	{
+		std::vector<std::string> words;
+		std::istringstream stream(instruction);
+
+		std::string word;
+		while (stream >> word)
+			words.emplace_back(std::move(word));
+
+		return words;
+	}
+
+	/**
+	 * Get the width flag of a scalar type declaration.
+	 *
+	 * @param opcode The declaration's opcode.
+	 * @param width The width of the scalar.
+	 * @return The width flag. This is 0 if the scalar does not need a capability.
+	 */
+	uint8_t GetWidthFlag(const std::string& opcode, const std::string& width)
+	{
+		if (opcode == "OpTypeInt")
+		{
+			if (width == "8")
+				return Integer8;
+
+			if (width == "16")
+				return Integer16;
+
+			if (width == "64")
+				return Integer64;
+		}
+		else if (width == "16")
+			return Float16;
+
+		else if (width == "64")
+			return Float64;
+
+		return 0;
+	}
+
+	/**
+	 * Check if an instruction is allowed on 8 and 16 bit types by the storage capabilities alone.
+	 *
+	 * @param opcode The instruction's opcode.
+	 * @return True if the instruction only moves or converts the value.
+	 * @return False if the instruction needs the arithmetic capability of the type.
+	 */
+	bool IsStorageInstruction(const std::string& opcode)
+	{
+		constexpr const char* storageInstructions[] = { "OpLoad", "OpVariable", "OpAccessChain", "OpInBoundsAccessChain", "OpPtrAccessChain", "OpCopyObject", "OpUConvert", "OpSConvert", "OpFConvert" };
+		return std::any_of(std::begin(storageInstructions), std::end(storageInstructions), [&opcode](const char* name) { return opcode == name; });
+	}
+
+	/**
+	 * Get the storage capability which allows 8 or 16 bit types in a storage class.
+	 *
+	 * @param storageClass The storage class.
+	 * @param is8Bit Whether the type is 8 bit or 16 bit.
+	 * @return The capability name. This is nullptr if the storage class does not have a storage capability.
+	 */
+	const char* GetStorageCapability(const std::string& storageClass, bool is8Bit)
+	{
+		if (storageClass == "StorageBuffer" || storageClass == "PhysicalStorageBuffer")
+			return is8Bit ? "StorageBuffer8BitAccess" : "StorageBuffer16BitAccess";
+
+		if (storageClass == "Uniform")
+			return is8Bit ? "UniformAndStorageBuffer8BitAccess" : "UniformAndStorageBuffer16BitAccess";
+
+		if (storageClass == "PushConstant")
+			return is8Bit ? "StoragePushConstant8" : "StoragePushConstant16";
+
+		if (!is8Bit && (storageClass == "Input" || storageClass == "Output"))
+			return "StorageInputOutput16";
+
+		return nullptr;
+	}
+
+	/**
+	 * Check if an instruction is an access chain.
+	 *
+	 * @param opcode The instruction's opcode.
+	 * @return True if the instruction is an access chain.
+	 * @return False if the instruction is not an access chain.
+	 */
+	bool IsAccessChainInstruction(const std::string& opcode)
+	{
+		return opcode == "OpAccessChain" || opcode == "OpInBoundsAccessChain" || opcode == "OpPtrAccessChain";
+	}
+
+	/**
+	 * Check if an instruction must be kept even if its result is not used.
+	 *
+	 * @param opcode The instruction's opcode.
+	 * @return True if the instruction has side effects or is referenced by the control flow.
+	 * @return False if the instruction can be removed when its result is not used.
+	 */
+	bool HasSideEffects(const std::string& opcode)
+	{
+		return opcode == "OpLabel" || opcode == "OpFunctionCall" || opcode == "OpVariable" || opcode.starts_with("OpAtomic");
+	}
+
+	/**
+	 * Check if an instruction stores to the pointer at the given operand.
+	 *
+	 * @param words The words of the instruction.
+	 * @param index The index of the operand.
+	 * @return True if the operand is the pointer the instruction stores to.
+	 * @return False if the operand is read.
+	 */
+	bool IsStoreTarget(const std::vector<std::string>& words, uint64_t index)
+	{
+		return index == 1 && (words.front() == "OpStore" || words.front() == "OpCopyMemory");
+	}
+
+	/**
+	 * Collect the identifiers used by the operands of some instructions.
+	 *
+	 * @param instructions The instructions.
+	 * @param identifiers The set to insert the identifiers to, without the leading %.
+	 */
+	void CollectUsedIdentifiers(const ShaderBuilder::InstructionStorage& instructions, std::unordered_set<std::string>& identifiers)
+	{
+		for (const auto& instruction : instructions)
+		{
+			const auto words = SplitInstruction(instruction);
+			const uint64_t first = words.size() > 1 && words[1] == "=" ? 2 : 0;
+
+			for (uint64_t i = first; i < words.size(); i++)
+			{
+				if (words[i].front() == '%')
+					identifiers.insert(words[i].substr(1));
+			}
+		}
+	}
+
+	/**
+	 * Get the result identifier of an instruction.
+	 *
+	 * @param instruction The instruction.
+	 * @return The result identifier without the leading %. This is empty if the instruction does not have a result.
+	 */
+	std::string GetResultIdentifier(const std::string& instruction)
+	{
+		const auto separator = instruction.find(" = ");
+		if (instruction.empty() || instruction.front() != '%' || separator == std::string::npos)
+			return {};
+
+		return instruction.substr(1, separator - 1);
+	}
+
+	/**
+	 * Rename the identifiers used by an instruction.
+	 *
+	 * @param instruction The instruction.
+	 * @param identifiers The identifiers to rename, mapped to their new identifiers. These are stored without the leading %.
+	 * @return The renamed instruction.
+	 */
+	std::string RenameIdentifiers(const std::string& instruction, const std::unordered_map<std::string, std::string>& identifiers)
+	{
+		std::string renamed;
+		renamed.reserve(instruction.size());
+
+		for (uint64_t i = 0; i < instruction.size();)
+		{
+			if (instruction[i] != '%')
+			{
+				renamed += instruction[i++];
+				continue;
+			}
+
+			auto end = i + 1;
+			while (end < instruction.size() && (std::isalnum(static_cast<unsigned char>(instruction[end])) || instruction[end] == '_'))
+				end++;
+
+			const auto identifier = instruction.substr(i + 1, end - i - 1);
+			if (const auto itr = identifiers.find(identifier); itr != identifiers.end())
+				renamed += "%" + itr->second;
+
+			else
+				renamed += "%" + identifier;
+
+			i = end;
+		}
+
+		return renamed;
+	}
+}
 
 namespace ShaderBuilder
 {
+	std::string GetFastMathModeString(FastMathMode mode)
+	{
+		constexpr std::pair<FastMathMode, const char*> flags[] = {
+			{ FastMathMode::NotNaN, "NotNaN" },
+			{ FastMathMode::NotInf, "NotInf" },
+			{ FastMathMode::NSZ, "NSZ" },
+			{ FastMathMode::AllowRecip, "AllowRecip" },
+			{ FastMathMode::AllowContract, "AllowContract" },
+			{ FastMathMode::AllowReassoc, "AllowReassoc" },
+			{ FastMathMode::AllowTransform, "AllowTransform" }
+		};
+
+		std::string modeString;
+		for (const auto& [flag, name] : flags)
+		{
+			if (mode & flag)
+				modeString += modeString.empty() ? name : fmt::format("|{}", name);
+		}
+
+		return modeString.empty() ? "None" : modeString;
+	}
+
 	void FunctionBlock::enableRecording()
 	{
 		m_Definition.setShouldRecord(true);
@@ -52,6 +317,110 @@ namespace ShaderBuilder
 		m_ExecutionModes.insert(std::move(instruction));
 	}
 
+	bool SPIRVSource::insertInterfaceVariable(const std::string& identifier)
+	{
+		if (isInterfaceVariable(identifier))
+			return false;
+
+		m_InterfaceVariables.emplace_back(identifier);
+		return true;
+	}
+
+	bool SPIRVSource::isInterfaceVariable(const std::string& identifier) const
+	{
+		return std::find(m_InterfaceVariables.begin(), m_InterfaceVariables.end(), identifier) != m_InterfaceVariables.end();
+	}
+
+	std::string SPIRVSource::getInterfaceVariables() const
+	{
+		std::string interfaceList;
+		for (const auto& identifier : m_InterfaceVariables)
+			interfaceList += " %" + identifier;
+
+		return interfaceList;
+	}
+
+	void SPIRVSource::insertInputAttribute(InterfaceAttribute&& attribute)
+	{
+		m_InputAttributes.emplace_back(std::move(attribute));
+	}
+
+	void SPIRVSource::insertOutputAttribute(InterfaceAttribute&& attribute)
+	{
+		m_OutputAttributes.emplace_back(std::move(attribute));
+	}
+
+	void SPIRVSource::removeOutputs(const std::vector<std::string>& identifiers)
+	{
+		// The function variables are checked too, as the removed stores might have been their only readers.
+		std::unordered_set<std::string> candidates(identifiers.begin(), identifiers.end());
+		for (const auto& block : m_FunctionBlocks)
+		{
+			for (const auto& variable : block.m_Variables)
+				candidates.insert(GetResultIdentifier(variable));
+		}
+
+		// Removing an instruction might make its operands unused, so keep going until nothing else can be removed.
+		bool isRemoved = true;
+		while (isRemoved)
+		{
+			isRemoved = removeWriteOnlyVariables(candidates);
+			isRemoved |= removeUnusedResults();
+		}
+
+		removeUnusedVariables();
+	}
+
+	void SPIRVSource::removeUnusedVariables()
+	{
+		std::unordered_set<std::string> usedIdentifiers;
+		for (const auto& block : m_FunctionBlocks)
+		{
+			CollectUsedIdentifiers(block.m_Definition, usedIdentifiers);
+			CollectUsedIdentifiers(block.m_Parameters, usedIdentifiers);
+			CollectUsedIdentifiers(block.m_Variables, usedIdentifiers);
+			CollectUsedIdentifiers(block.m_Instructions, usedIdentifiers);
+		}
+
+		std::unordered_set<std::string> removedIdentifiers;
+		m_Types.removeIf([&usedIdentifiers, &removedIdentifiers](const std::string& instruction)
+			{
+				const auto words = SplitInstruction(instruction);
+				if (words.size() < 3 || words[2] != "OpVariable" || usedIdentifiers.contains(words[0].substr(1)))
+					return false;
+
+				removedIdentifiers.insert(words[0].substr(1));
+				return true;
+			}
+		);
+
+		if (removedIdentifiers.empty())
+			return;
+
+		auto isRemoved = [&removedIdentifiers](const std::string& identifier) { return removedIdentifiers.contains(identifier); };
+		auto isRemovedAttribute = [&removedIdentifiers](const InterfaceAttribute& attribute) { return removedIdentifiers.contains(attribute.m_Identifier); };
+		std::erase_if(m_InterfaceVariables, isRemoved);
+		std::erase_if(m_InputAttributes, isRemovedAttribute);
+		std::erase_if(m_OutputAttributes, isRemovedAttribute);
+
+		// Drop the variables from the entry point interfaces.
+		for (auto& instruction : m_EntryPoints)
+		{
+			std::string entryPoint;
+			for (const auto& word : SplitInstruction(instruction))
+			{
+				if (word.front() == '%' && isRemoved(word.substr(1)))
+					continue;
+
+				entryPoint += entryPoint.empty() ? word : " " + word;
+			}
+
+			instruction = std::move(entryPoint);
+		}
+
+		removeDecorationsAndNames(removedIdentifiers);
+	}
+
 	void SPIRVSource::insertName(std::string&& instruction)
 	{
 		m_DebugNames.insert(std::move(instruction));
@@ -67,15 +436,28 @@ namespace ShaderBuilder
 		m_Types.insert(std::move(instruction));
 	}
 
+	void SPIRVSource::insertFunctionDeclaration(std::string&& instruction)
+	{
+		m_FunctionDeclarations.insert(std::move(instruction));
+	}
+
+	void SPIRVSource::insertInstruction(std::string&& instruction)
+	{
+		getCurrentFunctionBlock().m_Instructions.insert(std::move(instruction));
+	}
+
 	ShaderBuilder::FunctionBlock& SPIRVSource::pushFunctionBlock()
 	{
-		return m_FunctionBlockStack.emplace();
+		auto& block = m_FunctionBlockStack.emplace();
+		block.m_PrecisionPolicy = m_DefaultPrecisionPolicy;
+
+		return block;
 	}
 
 	ShaderBuilder::FunctionBlock& SPIRVSource::getCurrentFunctionBlock()
 	{
 		if (m_FunctionBlockStack.empty())
-			return m_FunctionBlockStack.emplace();
+			return pushFunctionBlock();
 
 		return m_FunctionBlockStack.top();
 	}
@@ -86,8 +468,343 @@ namespace ShaderBuilder
 		m_FunctionBlockStack.pop();
 	}
 
+	std::optional<std::string> SPIRVSource::inlineFunction(const std::string& name, const std::vector<std::string>& arguments, bool force)
+	{
+		if (m_InlineThreshold == 0)
+			return std::nullopt;
+
+		const auto block = std::find_if(m_FunctionBlocks.begin(), m_FunctionBlocks.end(), [&name](const FunctionBlock& block) { return block.m_Name == name; });
+		if (block == m_FunctionBlocks.end() || block->m_Instructions.size() == 0)
+			return std::nullopt;
+
+		// The last instruction is the return, which is handled separately.
+		const auto instructionCount = block->m_Instructions.size() - 1;
+		if (!force && instructionCount > m_InlineThreshold)
+			return std::nullopt;
+
+		const auto returnInstruction = *(block->m_Instructions.end() - 1);
+		if (std::any_of(block->m_Instructions.begin(), block->m_Instructions.end() - 1, IsControlFlowInstruction))
+			return std::nullopt;
+
+		// Replace the parameters with the arguments.
+		std::unordered_map<std::string, std::string> identifiers;
+		auto argument = arguments.begin();
+		for (const auto& parameter : block->m_Parameters)
+		{
+			if (argument == arguments.end())
+				return std::nullopt;
+
+			identifiers[GetResultIdentifier(parameter)] = (argument++)->substr(1);
+		}
+
+		// Everything the function defines gets a new identifier.
+		std::unordered_set<std::string> results;
+		auto& currentBlock = getCurrentFunctionBlock();
+		for (const auto& variable : block->m_Variables)
+		{
+			const auto result = GetResultIdentifier(variable);
+			identifiers[result] = getUniqueIdentifier();
+			results.insert(result);
+
+			currentBlock.m_Variables.insert(RenameIdentifiers(variable, identifiers));
+		}
+
+		for (auto itr = block->m_Instructions.begin(); itr != block->m_Instructions.end() - 1; ++itr)
+		{
+			if (const auto result = GetResultIdentifier(*itr); !result.empty())
+			{
+				identifiers[result] = getUniqueIdentifier();
+				results.insert(result);
+			}
+
+			currentBlock.m_Instructions.insert(RenameIdentifiers(*itr, identifiers));
+		}
+
+		// The new identifiers need the same decorations as the ones they replace, like the precision and aliasing.
+		constexpr std::string_view decoration = "OpDecorate %";
+		std::vector<std::string> annotations;
+		for (const auto& annotation : m_Annotations)
+		{
+			if (!annotation.starts_with(decoration))
+				continue;
+
+			const auto target = annotation.substr(decoration.size(), annotation.find(' ', decoration.size()) - decoration.size());
+			if (results.contains(target))
+				annotations.emplace_back(RenameIdentifiers(annotation, identifiers));
+		}
+
+		for (auto& annotation : annotations)
+			insertAnnotation(std::move(annotation));
+
+		// Resolve the returned value.
+		constexpr std::string_view returnValue = "OpReturnValue %";
+		if (returnInstruction.starts_with(returnValue))
+			return RenameIdentifiers(returnInstruction, identifiers).substr(returnValue.size());
+
+		return std::string();
+	}
+
+	void SPIRVSource::decoratePrecision(const std::string& identifier, std::string_view instruction, std::string_view typeIdentifier, const PrecisionPolicy& policy)
+	{
+		// SPV_KHR_float_controls2 does not allow both decorations on the same result, and NoContraction would contradict AllowContract anyway.
+		if (policy.m_NoContraction && policy.m_FastMathMode != FastMathMode::None)
+			throw BuilderError("A precision policy cannot use both NoContraction and a fast math mode! Use a fast math mode without AllowContract instead.");
+
+		// SPV_KHR_float_controls2 only allows transformations which are also allowed to reassociate and contract.
+		if (policy.m_FastMathMode & FastMathMode::AllowTransform && !(policy.m_FastMathMode & FastMathMode::AllowReassoc && policy.m_FastMathMode & FastMathMode::AllowContract))
+			throw BuilderError("The AllowTransform fast math mode requires AllowReassoc and AllowContract!");
+
+		// Booleans and device pointers do not have a precision.
+		if (policy.m_RelaxedPrecision && typeIdentifier != "%bool" && !typeIdentifier.starts_with("%device_pointer_"))
+			insertAnnotation(fmt::format("OpDecorate %{} RelaxedPrecision", identifier));
+
+		if (!IsFloatArithmeticInstruction(instruction))
+			return;
+
+		if (policy.m_NoContraction)
+			insertAnnotation(fmt::format("OpDecorate %{} NoContraction", identifier));
+
+		if (policy.m_FastMathMode != FastMathMode::None)
+		{
+			insertCapability("OpCapability FloatControls2");
+			insertExtension("OpExtension \"SPV_KHR_float_controls2\"");
+			insertAnnotation(fmt::format("OpDecorate %{} FPFastMathMode {}", identifier, GetFastMathModeString(policy.m_FastMathMode)));
+		}
+	}
+
+	void SPIRVSource::inferCapabilities(UniqueInstructionStorage& capabilities, UniqueInstructionStorage& extensions) const
+	{
+		std::unordered_map<std::string, uint8_t> typeWidths;
+		auto getWidths = [&typeWidths](const std::string& identifier) -> uint8_t
+		{
+			const auto itr = typeWidths.find(identifier);
+			return itr != typeWidths.end() ? itr->second : 0;
+		};
+
+		// Find the widths used by each type, and the storage classes they are used in.
+		uint8_t requiredWidths = 0;
+		for (const auto& instruction : m_Types)
+		{
+			const auto words = SplitInstruction(instruction);
+			if (words.size() < 4 || words[1] != "=")
+				continue;
+
+			const auto& opcode = words[2];
+			if (opcode == "OpTypeInt" || opcode == "OpTypeFloat")
+			{
+				const auto width = GetWidthFlag(opcode, words[3]);
+				typeWidths[words[0]] = width;
+				requiredWidths |= width & ~StorableWidths;
+			}
+			else if (opcode == "OpTypePointer" && words.size() > 4)
+			{
+				const auto widths = getWidths(words[4]);
+				const auto& storageClass = words[3];
+
+				// Device pointers are only available with the physical storage buffer addresses.
+				if (storageClass == "PhysicalStorageBuffer")
+				{
+					capabilities.insert("OpCapability PhysicalStorageBufferAddresses");
+					extensions.insert("OpExtension \"SPV_KHR_physical_storage_buffer\"");
+				}
+
+				if (widths & Integer8)
+				{
+					if (const auto capability = GetStorageCapability(storageClass, true))
+					{
+						capabilities.insert(fmt::format("OpCapability {}", capability));
+						extensions.insert("OpExtension \"SPV_KHR_8bit_storage\"");
+					}
+					else
+						requiredWidths |= Integer8;
+				}
+
+				if (widths & (Integer16 | Float16))
+				{
+					if (const auto capability = GetStorageCapability(storageClass, false))
+					{
+						capabilities.insert(fmt::format("OpCapability {}", capability));
+						extensions.insert("OpExtension \"SPV_KHR_16bit_storage\"");
+					}
+					else
+						requiredWidths |= widths & (Integer16 | Float16);
+				}
+			}
+			else if (opcode.starts_with("OpConstant") || opcode.starts_with("OpSpecConstant"))
+				requiredWidths |= getWidths(words[3]) & StorableWidths;
+
+			else if (opcode.starts_with("OpType") && opcode != "OpTypeFunction")
+			{
+				uint8_t widths = 0;
+				for (uint64_t i = 3; i < words.size(); i++)
+					widths |= getWidths(words[i]);
+
+				typeWidths[words[0]] = widths;
+			}
+		}
+
+		// Any other use of the 8 and 16 bit types needs their arithmetic capabilities.
+		auto checkInstructions = [&requiredWidths, &getWidths](const InstructionStorage& instructions)
+		{
+			for (const auto& instruction : instructions)
+			{
+				const auto words = SplitInstruction(instruction);
+				if (words.size() > 3 && words[1] == "=" && !IsStorageInstruction(words[2]))
+					requiredWidths |= getWidths(words[3]) & StorableWidths;
+			}
+		};
+
+		for (const auto& block : m_FunctionBlocks)
+		{
+			checkInstructions(block.m_Definition);
+			checkInstructions(block.m_Parameters);
+			checkInstructions(block.m_Instructions);
+		}
+
+		constexpr std::pair<uint8_t, const char*> widthCapabilities[] = {
+			{ Integer8, "OpCapability Int8" },
+			{ Integer16, "OpCapability Int16" },
+			{ Integer64, "OpCapability Int64" },
+			{ Float16, "OpCapability Float16" },
+			{ Float64, "OpCapability Float64" }
+		};
+
+		for (const auto& [width, capability] : widthCapabilities)
+		{
+			if (requiredWidths & width)
+				capabilities.insert(capability);
+		}
+	}
+
+	bool SPIRVSource::removeWriteOnlyVariables(const std::unordered_set<std::string>& candidates)
+	{
+		// Find the variable each access chain points into.
+		std::unordered_map<std::string, std::string> bases;
+		for (const auto& block : m_FunctionBlocks)
+		{
+			for (const auto& instruction : block.m_Instructions)
+			{
+				const auto words = SplitInstruction(instruction);
+				if (words.size() > 4 && words[1] == "=" && IsAccessChainInstruction(words[2]))
+					bases[words[0].substr(1)] = words[4].substr(1);
+			}
+		}
+
+		auto getRoot = [&bases](std::string identifier)
+		{
+			for (auto itr = bases.find(identifier); itr != bases.end(); itr = bases.find(identifier))
+				identifier = itr->second;
+
+			return identifier;
+		};
+
+		// A variable is read if any of its pointers is used by something other than a store to it or an access chain into it.
+		auto writeOnlyVariables = candidates;
+		for (const auto& block : m_FunctionBlocks)
+		{
+			for (const auto& instruction : block.m_Instructions)
+			{
+				const auto words = SplitInstruction(instruction);
+				const bool isAccessChain = words.size() > 4 && words[1] == "=" && IsAccessChainInstruction(words[2]);
+				const uint64_t first = words.size() > 1 && words[1] == "=" ? 2 : 0;
+
+				for (uint64_t i = first; i < words.size(); i++)
+				{
+					if (words[i].front() != '%' || IsStoreTarget(words, i) || (isAccessChain && i == 4))
+						continue;
+
+					writeOnlyVariables.erase(getRoot(words[i].substr(1)));
+				}
+			}
+		}
+
+		std::unordered_set<std::string> removedIdentifiers;
+		uint64_t removedCount = 0;
+		for (auto& block : m_FunctionBlocks)
+		{
+			removedCount += block.m_Instructions.removeIf([&writeOnlyVariables, &removedIdentifiers, &getRoot](const std::string& instruction)
+				{
+					const auto words = SplitInstruction(instruction);
+					if (words.size() > 1 && IsStoreTarget(words, 1))
+						return writeOnlyVariables.contains(getRoot(words[1].substr(1)));
+
+					if (words.size() > 4 && words[1] == "=" && IsAccessChainInstruction(words[2]) && writeOnlyVariables.contains(getRoot(words[0].substr(1))))
+					{
+						removedIdentifiers.insert(words[0].substr(1));
+						return true;
+					}
+
+					return false;
+				}
+			);
+
+			removedCount += block.m_Variables.removeIf([&writeOnlyVariables, &removedIdentifiers](const std::string& instruction)
+				{
+					const auto identifier = GetResultIdentifier(instruction);
+					if (!writeOnlyVariables.contains(identifier))
+						return false;
+
+					removedIdentifiers.insert(identifier);
+					return true;
+				}
+			);
+		}
+
+		removeDecorationsAndNames(removedIdentifiers);
+		return removedCount > 0;
+	}
+
+	bool SPIRVSource::removeUnusedResults()
+	{
+		std::unordered_set<std::string> usedIdentifiers;
+		for (const auto& block : m_FunctionBlocks)
+		{
+			CollectUsedIdentifiers(block.m_Variables, usedIdentifiers);
+			CollectUsedIdentifiers(block.m_Instructions, usedIdentifiers);
+		}
+
+		std::unordered_set<std::string> removedIdentifiers;
+		for (auto& block : m_FunctionBlocks)
+		{
+			block.m_Instructions.removeIf([&usedIdentifiers, &removedIdentifiers](const std::string& instruction)
+				{
+					const auto words = SplitInstruction(instruction);
+					if (words.size() < 3 || words[1] != "=" || HasSideEffects(words[2]) || usedIdentifiers.contains(words[0].substr(1)))
+						return false;
+
+					removedIdentifiers.insert(words[0].substr(1));
+					return true;
+				}
+			);
+		}
+
+		removeDecorationsAndNames(removedIdentifiers);
+		return !removedIdentifiers.empty();
+	}
+
+	void SPIRVSource::removeDecorationsAndNames(const std::unordered_set<std::string>& identifiers)
+	{
+		if (identifiers.empty())
+			return;
+
+		// Decorations and names always target their first operand.
+		auto isTargetRemoved = [&identifiers](const std::string& instruction)
+		{
+			const auto words = SplitInstruction(instruction);
+			return words.size() > 1 && words[1].front() == '%' && identifiers.contains(words[1].substr(1));
+		};
+
+		m_Annotations.removeIf(isTargetRemoved);
+		m_DebugNames.removeIf(isTargetRemoved);
+	}
+
 	std::string SPIRVSource::getSourceAssembly() const
 	{
+		// Declare only the capabilities and extensions the used types need.
+		auto capabilities = m_Capabilities;
+		auto extensions = m_Extensions;
+		inferCapabilities(capabilities, extensions);
+
 		std::stringstream finalTransform;
 		finalTransform << "; Magic:     0x07230203 (SPIR-V)" << std::endl;
 		finalTransform << "; Version:   0x00010000 (Version: 1.0.0)" << std::endl;
@@ -96,12 +813,12 @@ namespace ShaderBuilder
 
 		// Insert the capabilities.
 		finalTransform << std::endl << "; Capabilities." << std::endl;
-		for (const auto& instruction : m_Capabilities)
+		for (const auto& instruction : capabilities)
 			finalTransform << instruction << std::endl;
 
 		// Insert the extensions.
 		finalTransform << std::endl << "; Extensions." << std::endl;
-		for (const auto& instruction : m_Extensions)
+		for (const auto& instruction : extensions)
 			finalTransform << instruction << std::endl;
 
 		// Insert the extended instructions.
@@ -4,51 +4,41 @@
 
 namespace ShaderBuilder
 {
-	VertexFunctionBuilder::VertexFunctionBuilder(SPIRVSource& source)
-		: FunctionBuilder(source)
+	void VertexFunctionBuilder::setPoisition(const Vec4<float>& value)
 	{
-		// Setup the annotations.
-		m_Source.insertAnnotation("OpMemberDecorate %gl_PerVertex 0 BuiltIn Position");
-		m_Source.insertAnnotation("OpMemberDecorate %gl_PerVertex 1 BuiltIn PointSize");
-		m_Source.insertAnnotation("OpMemberDecorate %gl_PerVertex 2 BuiltIn ClipDistance");
-		m_Source.insertAnnotation("OpMemberDecorate %gl_PerVertex 3 BuiltIn CullDistance");
-		m_Source.insertAnnotation("OpDecorate %gl_PerVertex Block");
+		if (m_IsRecording)
+		{
+			auto position = getBuiltIn<Vec4<float>>("Position", "Output");
+			position = value;
+		}
+	}
 
-		// Setup the names.
-		m_Source.insertName("OpName %gl_PerVertex \"gl_PerVertex\"");
-		m_Source.insertName("OpMemberName %gl_PerVertex 0 \"gl_Position\"");
-		m_Source.insertName("OpMemberName %gl_PerVertex 1 \"gl_PointSize\"");
-		m_Source.insertName("OpMemberName %gl_PerVertex 2 \"gl_ClipDistance\"");
-		m_Source.insertName("OpMemberName %gl_PerVertex 3 \"gl_CullDistance\"");
+	void VertexFunctionBuilder::setPointSize(const Scalar<float>& size)
+	{
+		if (m_IsRecording)
+		{
+			auto pointSize = getBuiltIn<Scalar<float>>("PointSize", "Output");
+			pointSize = size;
+		}
+	}
 
-		// Register the types.
-		m_Source.registerType<Vec4<float>>();
-		m_Source.registerType<float>();
-		m_Source.registerType<int>();
-		m_Source.registerArray<float, 1>();
+	VertexBuilder VertexBuilder::createDepthOnlyVariant() const
+	{
+		if (!m_Source.isInterfaceVariable("gl_Position"))
+			throw BuilderError("Cannot create a depth-only variant of a shader which does not set the position!");
 
-		// Setup the types.
-		m_Source.insertType("%gl_PerVertex = OpTypeStruct %vec4_float %float %array_float_1 %array_float_1");
-		m_Source.insertType("%pointer_gl_PerVertex = OpTypePointer Output %gl_PerVertex");
-		m_Source.insertType("%perVertex = OpVariable %pointer_gl_PerVertex Output");
-		m_Source.insertType("%type_gl_Position = OpTypePointer Output %vec4_float");
+		// The built-in outputs are not location outputs, so the position is kept.
+		auto variant = *this;
+		std::vector<std::string> outputs;
+		for (const auto& output : variant.m_Source.getOutputAttributes())
+			outputs.emplace_back(output.m_Identifier);
 
-		// Setup constants.
-		m_Source.storeConstant(0);
-		m_Source.storeConstant(1);
+		variant.m_Source.removeOutputs(outputs);
+		return variant;
 	}
 
-	void VertexFunctionBuilder::setPoisition(const Vec4<float>& value)
+	std::pair<SPIRVBinary, SPIRVBinary> VertexBuilder::compileWithDepthOnlyVariant(OptimizationFlags flags /*= OptimizationFlags::Release*/) const
 	{
-		if (m_IsRecording)
-		{
-			auto& currentBlock = m_Source.getCurrentFunctionBlock();
-			const auto valuePointer = fmt::format("%{}", m_Source.getUniqueIdentifier());
-			currentBlock.m_Instructions.insert(fmt::format("{} = OpLoad %vec4_float %{}", valuePointer, value.getName()));
-
-			const auto positionPointer = fmt::format("%{}", m_Source.getUniqueIdentifier());
-			currentBlock.m_Instructions.insert(fmt::format("{} = OpAccessChain %type_gl_Position %perVertex %{}", positionPointer, GetConstantIdentifier(0)));
-			currentBlock.m_Instructions.insert(fmt::format("OpStore {} {}", positionPointer, valuePointer));
-		}
+		return { compile(flags), createDepthOnlyVariant().compile(flags) };
 	}
-} // namespace ShaderBuilder
\ No newline at end of file
+} // namespace ShaderBuilder